@@ -1,12 +1,60 @@
 #pragma once
+#include <array>
+
+#include "euclid/attacks_tbl.hpp"
 #include "euclid/board.hpp"
+#include "euclid/move.hpp"
 
 namespace euclid {
 
+// Every piece (both colors) attacking square s, with sliders seen through 'occ'.
+// Passing a modified occupancy lets callers lift a moving king or x-ray through pieces.
+U64 attackers_to(const Board& b, Square s, U64 occ);
+inline U64 attackers_to(const Board& b, Square s) { return attackers_to(b, s, b.occupancy()); }
+
+// Is square s attacked by side 'By', given occupancy occ? Leapers are tested
+// first and each test exits early, so this is cheaper than attackers_to.
+template <Color By>
+inline bool square_attacked(const Board& b, Square s, U64 occ) {
+  constexpr Color Victim = (By == Color::White) ? Color::Black : Color::White;
+  const auto& T = ATT();
+  const std::size_t si = static_cast<std::size_t>(s);
+  if (T.pawn_att[static_cast<std::size_t>(Victim)][si] & b.pieces(By, Piece::Pawn)) return true;
+  if (T.knight_att[si] & b.pieces(By, Piece::Knight)) return true;
+  if (T.king_att[si] & b.pieces(By, Piece::King)) return true;
+  const U64 queens = b.pieces(By, Piece::Queen);
+  if (bishop_attacks(s, occ) & (b.pieces(By, Piece::Bishop) | queens)) return true;
+  if (rook_attacks(s, occ)   & (b.pieces(By, Piece::Rook)   | queens)) return true;
+  return false;
+}
+
+// Same test on the current occupancy (the attacking side is fixed at compile time
+// for the color-templated move generator).
+template <Color By>
+inline bool square_attacked(const Board& b, Square s) {
+  return square_attacked<By>(b, s, b.occupancy());
+}
+
 // Is square s attacked by side 'by'?
 bool square_attacked(const Board& b, Square s, Color by);
 
 // Is 'side' currently in check?
 bool in_check(const Board& b, Color side);
 
+// What a move of the side to move needs in order to check the enemy king.
+// Built once per node by check_squares(); gives_check() then answers per move
+// without making it.
+struct CheckSquares {
+  Square ksq = -1;                     // enemy king (-1 if absent)
+  std::array<U64, PIECE_N> squares{};  // squares from which each piece type attacks ksq
+  U64 discovered = 0ULL;               // our pieces whose departure uncovers a slider on ksq
+};
+
+CheckSquares check_squares(const Board& b);
+
+// Does pseudo-legal move m (side to move) give check? Covers direct, discovered,
+// promotion, en-passant and castling-rook checks.
+bool gives_check(const Board& b, const Move& m, const CheckSquares& cs);
+inline bool gives_check(const Board& b, const Move& m) { return gives_check(b, m, check_squares(b)); }
+
 } // namespace euclid
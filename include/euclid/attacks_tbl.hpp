@@ -1,7 +1,10 @@
 #pragma once
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
+#include "euclid/types.hpp"
+
 namespace euclid {
 
 // Direction indices (clockwise)
@@ -17,9 +20,107 @@ struct AttackTables {
   // Rays: for each direction, up to 7 squares to the edge
   std::array<std::array<std::array<int,7>,64>,8> rays{};
   std::array<std::array<uint8_t,64>,8>           ray_len{};
+
+  // Bitboard forms: squares attacked from s (pawn_att[color][s] = pawn captures)
+  std::array<U64,64>                knight_att{};
+  std::array<U64,64>                king_att{};
+  std::array<std::array<U64,64>,2>  pawn_att{};
+
+  // Squares strictly between a and b when aligned on a rank/file/diagonal, else 0
+  std::array<std::array<U64,64>,64> between{};
+  // Whole line (edge to edge, a and b included) through aligned a and b, else 0
+  std::array<std::array<U64,64>,64> line{};
+};
+
+// Computed at compile time in attacks_tbl.cpp (constexpr, no runtime init).
+extern const AttackTables ATTACK_TABLES;
+inline const AttackTables& ATT() { return ATTACK_TABLES; }
+
+// ---- Slider attack backends ----
+// Pext:  index = pext(occ, mask)                       (BMI2, x86-64 only)
+// Magic: index = ((occ & mask) * magic) >> shift
+// Ray:   reference walk along the rays (no table)
+// The backend is picked from CPUID (see detect_slider_backend()) while the
+// tables are built during static initialization.
+enum class SliderBackend : int { Ray = 0, Magic = 1, Pext = 2 };
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define EUCLID_HAS_PEXT 1
+// Inline asm instead of _pext_u64 so the binary does not need -mbmi2; only ever
+// executed after CPUID reported BMI2.
+inline U64 pext_u64(U64 src, U64 mask) {
+  U64 out;
+  __asm__("pextq %2, %1, %0" : "=r"(out) : "r"(src), "rm"(mask));
+  return out;
+}
+#else
+#define EUCLID_HAS_PEXT 0
+#endif
+
+struct Magic {
+  U64      mask = 0;   // relevant blockers (board edges excluded)
+  U64      magic = 0;
+  unsigned offset = 0; // first entry of this square in SliderTables::table
+  unsigned shift = 0;  // 64 - popcount(mask)
+
+  std::size_t index(U64 occ) const {
+    return static_cast<std::size_t>(((occ & mask) * magic) >> shift);
+  }
+};
+
+inline constexpr std::size_t SLIDER_TABLE_SIZE = 102400 + 5248; // rook + bishop entries
+
+struct SliderTables {
+  std::array<Magic,64>              rook{};
+  std::array<Magic,64>              bishop{};
+  std::array<U64,SLIDER_TABLE_SIZE> table{}; // laid out for SLIDER_BACKEND
 };
 
-// Singleton accessor (built once, reused everywhere)
-const AttackTables& ATT();
+// Plain globals, constant-initialized (empty) in attacks_tbl.cpp and filled by
+// the first SliderInit; afterwards only set_slider_backend() writes them.
+extern SliderTables  SLIDER_TABLES;
+extern SliderBackend SLIDER_BACKEND;
+inline const SliderTables& SLIDERS() { return SLIDER_TABLES; }
+
+// Every file that includes this header constructs a SliderInit before its own
+// static objects (the std::ios_base::Init scheme), so even a lookup from another
+// file's static initializer sees built tables. Only the first one does any work.
+struct SliderInit { SliderInit(); };
+static const SliderInit SLIDER_INIT;
+
+// Best backend supported by the running CPU (Pext > Magic).
+SliderBackend detect_slider_backend();
+bool slider_backend_supported(SliderBackend be);
+const char* slider_backend_name(SliderBackend be);
+inline SliderBackend slider_backend() { return SLIDER_BACKEND; }
+
+// Re-lays out the shared table for 'be'. Returns false (and keeps the current
+// backend) if the CPU cannot run it. Not thread-safe: call before searching.
+bool set_slider_backend(SliderBackend be);
+
+// Ray-walk fallback (out of line; only used by SliderBackend::Ray)
+U64 ray_bishop_attacks(int s, U64 occ);
+U64 ray_rook_attacks(int s, U64 occ);
+
+inline U64 slider_attacks(const Magic& m, U64 occ) {
+#if EUCLID_HAS_PEXT
+  if (SLIDER_BACKEND == SliderBackend::Pext) return SLIDER_TABLES.table[m.offset + pext_u64(occ, m.mask)];
+#endif
+  return SLIDER_TABLES.table[m.offset + m.index(occ)];
+}
+
+inline U64 bishop_attacks(int s, U64 occ) {
+  if (SLIDER_BACKEND == SliderBackend::Ray) [[unlikely]] return ray_bishop_attacks(s, occ);
+  return slider_attacks(SLIDER_TABLES.bishop[static_cast<std::size_t>(s)], occ);
+}
+
+inline U64 rook_attacks(int s, U64 occ) {
+  if (SLIDER_BACKEND == SliderBackend::Ray) [[unlikely]] return ray_rook_attacks(s, occ);
+  return slider_attacks(SLIDER_TABLES.rook[static_cast<std::size_t>(s)], occ);
+}
+
+inline U64 queen_attacks(int s, U64 occ) {
+  return bishop_attacks(s, occ) | rook_attacks(s, occ);
+}
 
 } // namespace euclid
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace euclid {
+
+// Built-in positions for the fixed-depth search bench: openings, middlegames,
+// endgames and tactical positions. Changing this list changes the signature.
+const std::vector<std::string>& bench_positions();
+
+struct SearchBenchResult {
+  int positions = 0;
+  std::uint64_t nodes = 0;  // the signature: identical nodes => identical search
+  double seconds = 0.0;
+};
+
+// Searches every bench position to 'depth', each from a cold search_reset(),
+// with no time or node limit. Per-position lines go to 'log' when non-null.
+SearchBenchResult run_search_bench(int depth, std::ostream* log = nullptr);
+
+} // namespace euclid
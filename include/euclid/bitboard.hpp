@@ -0,0 +1,24 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+
+#include "euclid/types.hpp"
+
+namespace euclid {
+
+// Small bitboard helpers shared by movegen / attack detection.
+inline constexpr U64 square_bb(Square s) { return 1ULL << static_cast<unsigned>(s); }
+
+inline int popcount(U64 bb) { return std::popcount(bb); }
+
+// Index of the least significant set bit (bb must be non-zero).
+inline Square lsb(U64 bb) { return static_cast<Square>(std::countr_zero(bb)); }
+
+// Returns the least significant square and clears it from bb (bb must be non-zero).
+inline Square pop_lsb(U64& bb) {
+  const Square s = lsb(bb);
+  bb &= bb - 1ULL;
+  return s;
+}
+
+} // namespace euclid
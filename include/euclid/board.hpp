@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 #include "euclid/types.hpp"
@@ -12,8 +13,9 @@ struct Castling { // bit 0..3 = KQkq
   unsigned rights = 0; // K=1, Q=2, k=4, q=8
 };
 
-// Engine-wide Zobrist table accessor (defined in src/board.cpp).
-const Zobrist& zobrist();
+// Engine-wide Zobrist table, generated at compile time in src/board.cpp.
+extern const Zobrist ZOBRIST_TABLE;
+inline const Zobrist& zobrist() { return ZOBRIST_TABLE; }
 
 class Board {
 public:
@@ -28,6 +30,7 @@ public:
   void set_side_to_move(Color c) {
     if (stm_ == c) return;
     stm_ = c;
+    check_info_valid_ = false;
     // toggle side-to-move key (convention: XOR when Black to move)
     hash_ ^= zobrist().side_to_move;
   }
@@ -75,8 +78,34 @@ public:
   // zobrist hash
   U64 hash() const { return hash_; }
 
-  // query
-  Piece piece_at(Square s, Color* c_out = nullptr) const;
+  // query (mailbox lookup; empty squares report Piece::None / Color::White)
+  Piece piece_at(Square s, Color* c_out = nullptr) const {
+    const std::uint8_t v = mailbox_[static_cast<std::size_t>(s)];
+    if (c_out) *c_out = static_cast<Color>(v >> 3);
+    return static_cast<Piece>(v & 7u);
+  }
+
+  // bitboards (occupancy maintained incrementally by set_piece/remove_piece)
+  U64 pieces(Color c, Piece p) const {
+    return bb_[static_cast<std::size_t>(c)][static_cast<std::size_t>(p)];
+  }
+  U64 occupancy(Color c) const { return occ_[static_cast<std::size_t>(c)]; }
+  U64 occupancy() const { return occ_[0] | occ_[1]; }
+
+  // king square (-1 if that side has no king, e.g. odd test setups)
+  Square king_square(Color c) const { return king_sq_[static_cast<std::size_t>(c)]; }
+
+  // Per-position check info for the side to move, computed on first use after
+  // the position changes and cached until the next set_piece/remove_piece/stm flip.
+  // (Lazy refresh mutates the cache: copy a Board before sharing it across threads.)
+  U64 checkers() const {  // enemy pieces giving check
+    if (!check_info_valid_) refresh_check_info_();
+    return checkers_;
+  }
+  U64 pinned() const {    // side-to-move pieces pinned to their own king
+    if (!check_info_valid_) refresh_check_info_();
+    return pinned_;
+  }
 
   // clocks
   void set_halfmove_clock(int h) { halfmove_clock_ = h; }
@@ -88,6 +117,10 @@ public:
 private:
   // bitboards[color][piece]
   std::array<std::array<U64, PIECE_N>, COLOR_N> bb_{};
+  // mailbox[square] = piece | (color << 3); kept in sync with bb_ by set_piece/remove_piece
+  std::array<std::uint8_t, 64> mailbox_{};
+  std::array<U64, COLOR_N> occ_{};
+  std::array<Square, COLOR_N> king_sq_{-1, -1};
   Color stm_ = Color::White;
   Castling castling_{};
   Square ep_square_ = -1; // -1 = none
@@ -95,7 +128,18 @@ private:
   int halfmove_clock_ = 0;
   int fullmove_number_ = 1;
 
+  // derived check info (see checkers()/pinned())
+  mutable U64 checkers_ = 0ULL;
+  mutable U64 pinned_ = 0ULL;
+  mutable bool check_info_valid_ = false;
+
   void recompute_hash_();
+  void refresh_check_info_() const;
+
+  static constexpr std::uint8_t EMPTY_ = static_cast<std::uint8_t>(Piece::None);
+  static constexpr std::uint8_t code_(Color c, Piece p) {
+    return static_cast<std::uint8_t>(static_cast<unsigned>(p) | (static_cast<unsigned>(c) << 3));
+  }
 };
 
 } // namespace euclid
\ No newline at end of file
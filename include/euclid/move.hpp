@@ -6,25 +6,55 @@
 namespace euclid {
 
 
+// 4-bit move kind stored in the top bits of a packed Move.
+// Bit 2 = capture, bit 3 = promotion (low two bits then select N/B/R/Q).
 enum class MoveFlag : uint8_t {
 Quiet = 0,
-Capture = 1 << 0,
-DoublePush = 1 << 1,
-EnPassant = 1 << 2,
-Castle = 1 << 3,
-PromoKnight = 1 << 4,
-PromoBishop = 1 << 5,
-PromoRook = 1 << 6,
-PromoQueen = 1 << 7,
+DoublePush = 1,
+Castle = 2,
+Capture = 4,
+EnPassant = 5,
+PromoKnight = 8,
+PromoBishop = 9,
+PromoRook = 10,
+PromoQueen = 11,
+PromoKnightCapture = 12,
+PromoBishopCapture = 13,
+PromoRookCapture = 14,
+PromoQueenCapture = 15,
 };
 
 
+// Packed 16-bit move: bits 0-5 from, 6-11 to, 12-15 MoveFlag.
+// A default-constructed Move (a1a1, Quiet) is the "null" move.
 struct Move {
-Square from{0};
-Square to{0};
-MoveFlag flags{MoveFlag::Quiet};
-Piece promo{Piece::None};
+std::uint16_t data{0};
+
+constexpr Move() = default;
+constexpr Move(Square from, Square to, MoveFlag flag = MoveFlag::Quiet)
+  : data(static_cast<std::uint16_t>(from | (to << 6) | (static_cast<int>(flag) << 12))) {}
+
+constexpr Square from() const { return data & 0x3F; }
+constexpr Square to() const { return (data >> 6) & 0x3F; }
+constexpr MoveFlag flags() const { return static_cast<MoveFlag>(data >> 12); }
+
+constexpr bool is_null() const { return data == 0; }
+constexpr bool is_capture() const { return (data & 0x4000) != 0; }     // includes en passant
+constexpr bool is_promotion() const { return (data & 0x8000) != 0; }
+constexpr Piece promo() const {
+  return is_promotion() ? static_cast<Piece>(static_cast<int>(Piece::Knight) + ((data >> 12) & 3))
+                        : Piece::None;
+}
+
+friend constexpr bool operator==(const Move& a, const Move& b) { return a.data == b.data; }
 };
 
 
-} // namespace euclid
\ No newline at end of file
+// Promotion to 'promo' (Knight..Queen), optionally capturing.
+inline constexpr Move make_promotion(Square from, Square to, Piece promo, bool capture) {
+  const int f = 8 | (capture ? 4 : 0) | (static_cast<int>(promo) - static_cast<int>(Piece::Knight));
+  return Move(from, to, static_cast<MoveFlag>(f));
+}
+
+
+} // namespace euclid
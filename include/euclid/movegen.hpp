@@ -5,7 +5,34 @@
 namespace euclid {
 
 // Generate pseudo-legal moves for the side to move.
-// Legality (king not left in check) is enforced by callers via do_move + in_check.
+// Legality (king not left in check) is left to the caller (is_legal, or do_move + in_check).
 void generate_pseudo_legal(const Board& b, MoveList& out);
 
+// Generate only legal moves: check-evasion masks and pin rays are applied during
+// generation, so callers never need to make/unmake a move to test it.
+void generate_legal(const Board& b, MoveList& out);
+
+// Legal tactical moves only: captures, en passant and all promotions (quiet
+// push-promotions included). Quiet destinations are masked out up front, so
+// quiescence search never pays for generating quiets.
+void generate_captures(const Board& b, MoveList& out);
+
+// The complement of generate_captures: legal non-capturing, non-promoting
+// moves, castling included. captures + quiets == generate_legal.
+void generate_quiets(const Board& b, MoveList& out);
+
+// Legal replies to a check: king steps, captures of a single checker and
+// interpositions on its ray (king moves only under double check). Falls back
+// to generate_legal when the side to move is not in check.
+void generate_evasions(const Board& b, MoveList& out);
+
+// Would generate_pseudo_legal produce m (same squares and flags) in this position?
+// Validates moves from outside the current node (TT entries, killers) without
+// generating anything; follow with is_legal for king safety.
+bool is_pseudo_legal(const Board& b, const Move& m);
+
+// Cheap legality test for a pseudo-legal move of the side to move (no make/unmake):
+// king safety, pins, check evasion, castling path and en-passant discovered checks.
+bool is_legal(const Board& b, const Move& m);
+
 } // namespace euclid
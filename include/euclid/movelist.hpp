@@ -1,6 +1,7 @@
 #pragma once
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include "euclid/move.hpp"
 
 
@@ -10,10 +11,17 @@ namespace euclid {
 struct MoveList {
 static constexpr std::size_t CAP = 256;
 std::array<Move, CAP> data{};
+// Piece type on the destination as seen by the generator (Pawn for en passant,
+// None for quiet moves), so ordering never has to look at the board again.
+// One byte per move (Piece is int-sized); read it through captured(i).
+std::array<std::uint8_t, CAP> victim{};
 std::size_t sz = 0;
 
 
-void push(const Move& m) { if (sz < CAP) data[sz++] = m; }
+void push(const Move& m, Piece cap = Piece::None) {
+  if (sz < CAP) { victim[sz] = static_cast<std::uint8_t>(cap); data[sz++] = m; }
+}
+Piece captured(std::size_t i) const { return static_cast<Piece>(victim[i]); }
 const Move* begin() const { return data.data(); }
 const Move* end() const { return data.data() + sz; }
 std::size_t size() const { return sz; }
@@ -21,4 +29,4 @@ bool empty() const { return sz == 0; }
 };
 
 
-} // namespace euclid
\ No newline at end of file
+} // namespace euclid
@@ -1,5 +1,10 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include "euclid/types.hpp"
 #include "euclid/board.hpp"
@@ -7,10 +12,58 @@
 
 namespace euclid {
 
-std::uint64_t perft(const Board& b, int depth);
+// Optional perft cache: (Zobrist key, depth) -> node count. One entry per slot,
+// always replaced; a probe only hits on an exact key and depth match.
+// Lock-free and safe to share between perft threads: the key is stored XORed
+// with the data, so a torn read from a concurrent store simply misses.
+class PerftTT {
+public:
+  explicit PerftTT(std::size_t bytes);
+  void clear();
+
+  bool probe(U64 key, int depth, std::uint64_t& nodes) const;
+  void store(U64 key, int depth, std::uint64_t nodes);
+
+private:
+  struct Entry {
+    std::atomic<U64> check{0};          // key ^ data
+    std::atomic<std::uint64_t> data{0}; // nodes << 8 | depth (depth 0 = empty)
+  };
+  std::vector<Entry> entries_;
+  std::size_t mask_ = 0;
+};
+
+struct PerftOptions {
+  PerftTT* tt = nullptr;  // optional cache, shared by all threads
+  int threads = 1;        // worker threads (1 = run on the caller's thread)
+  int split_depth = 0;    // plies expanded into work items before the workers start (0 = auto)
+};
+
+// Leaf moves are counted, not made (bulk counting at depth 1).
+// Pass a PerftTT to also reuse subtree counts across transpositions.
+std::uint64_t perft(const Board& b, int depth, const PerftOptions& opt);
+inline std::uint64_t perft(const Board& b, int depth, PerftTT* tt = nullptr) {
+  return perft(b, depth, PerftOptions{tt, 1, 0});
+}
 
 // Per-move breakdown at root
 void perft_divide(const Board& b, int depth,
-                  std::vector<std::pair<Move, std::uint64_t>>& out);
+                  std::vector<std::pair<Move, std::uint64_t>>& out,
+                  const PerftOptions& opt);
+inline void perft_divide(const Board& b, int depth,
+                         std::vector<std::pair<Move, std::uint64_t>>& out,
+                         PerftTT* tt = nullptr) {
+  perft_divide(b, depth, out, PerftOptions{tt, 1, 0});
+}
+
+// One line of a perft EPD suite: "<fen> ;D1 20 ;D2 400 ...". The FEN may omit
+// the two clock fields (EPD style); they are filled in as "0 1".
+struct PerftEpd {
+  std::string fen;
+  std::vector<std::pair<int, std::uint64_t>> refs; // (depth, expected nodes), file order
+};
+
+// Returns false for blank lines, '#' comments and lines without any ;Dn entry.
+bool parse_perft_epd(std::string_view line, PerftEpd& out);
 
 } // namespace euclid
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "euclid/board.hpp"
@@ -14,6 +16,7 @@ struct SearchResult {
   int score{0};              // centipawns, POV = side to move
   std::uint64_t nodes{0};
   int depth{0};
+  int hashfull{0};           // TT permille written by this search (UCI "hashfull")
   std::vector<Move> pv;      // principal variation, best line
 };
 
@@ -25,9 +28,40 @@ struct SearchLimits {
   int wtime_ms = 0, btime_ms = 0;
   int winc_ms = 0, binc_ms = 0;
   int movestogo = 0;
+  int threads = 1;                  // Lazy SMP: >1 adds helper threads sharing the TT
+                                    // (ignored when nodes > 0: node limits search single-threaded)
   std::atomic<bool>* stop = nullptr;
 };
 
+// Owns all search state: TT, eval cache, killer/history tables and the limits of
+// the running search. Independent contexts can search concurrently from
+// different threads; one context runs one search at a time.
+class SearchContext {
+public:
+  SearchContext();                          // ~16 MB TT
+  explicit SearchContext(std::size_t ttBytes);
+  ~SearchContext();
+  SearchContext(const SearchContext&) = delete;
+  SearchContext& operator=(const SearchContext&) = delete;
+
+  SearchResult search(const Board& root, int maxDepth);
+  SearchResult search(const Board& root, const SearchLimits& lim);
+
+  // Clears TT, killer/history and the eval cache (see search_reset()).
+  void reset();
+  // Reallocates (and so clears) the TT.
+  void resize_tt(std::size_t bytes);
+
+  struct State;                             // defined in search.cpp
+  State& state() { return *st_; }
+
+private:
+  std::unique_ptr<State> st_;
+};
+
+// Process-wide context behind the free functions below (and the CLI/UCI).
+SearchContext& default_search_context();
+
 SearchResult search(const Board& root, int maxDepth);
 SearchResult search(const Board& root, const SearchLimits& lim);
 
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <array>
+
+#include "euclid/board.hpp"
+#include "euclid/move.hpp"
+#include "euclid/types.hpp"
+
+namespace euclid {
+
+// Material values used by the exchange evaluator (indexed by Piece; None = 0).
+inline constexpr std::array<int, PIECE_N + 1> SEE_VALUE = {100, 320, 330, 500, 900, 20000, 0};
+
+inline constexpr int see_value(Piece p) { return SEE_VALUE[static_cast<std::size_t>(p)]; }
+
+// Static exchange evaluation of move m (side to move) on its destination square:
+// the material balance after both sides recapture with their least valuable
+// attacker, each side free to stop. Sliders behind an exchanged piece (x-rays)
+// join in as the square opens up. Pins and checks are ignored.
+int see(const Board& b, const Move& m);
+
+// see(b, m) >= threshold, without building the whole swap list.
+bool see_ge(const Board& b, const Move& m, int threshold = 0);
+
+} // namespace euclid
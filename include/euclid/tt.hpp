@@ -1,4 +1,6 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 #include "euclid/types.hpp"      // U64, Piece, Color etc.
@@ -13,34 +15,64 @@ enum class TTBound : std::int8_t {
   Upper = 2    // alpha cut (score is an upper bound)
 };
 
+// Decoded copy of a slot, as returned by TT::probe. There is no key: a slot
+// keeps only 16 key bits, so a hit may belong to another position and callers
+// must validate the move (see is_pseudo_legal).
 struct TTEntry {
-  U64  key = 0;
   Move best{};           // principal/cut move
   std::int16_t depth = -1;
   std::int16_t score = 0;
   TTBound bound = TTBound::Exact;
 };
 
+// Shared by all search threads without locks: each slot is one 8-byte atomic
+// word (move | score | depth | bound | generation | key tag), so a read racing a
+// store sees either the old or the new entry, never a mix, and a store commits
+// with a compare-exchange on the word it based its decision on (racing stores
+// retry instead of merging). Only the top 16 key
+// bits are kept (the bucket index supplies the low ones); the rare false match
+// is why the search validates TT moves with is_pseudo_legal.
+//
+// Slots come in 64-byte buckets (one cache line) of BUCKET_ENTRIES; a key may
+// live in any slot of its bucket. Entries carry the generation of the search
+// that wrote them (new_search() bumps it), and a store into a full bucket
+// evicts the slot with the lowest depth - 8 * age, so deep entries from old
+// searches eventually make room.
 class TT {
 public:
+  static constexpr std::size_t BUCKET_ENTRIES = 8;
+
   TT();                       // default ~16 MB
   explicit TT(std::size_t bytes);
-  void   resize(std::size_t bytes);
+  void   resize(std::size_t bytes); // rounded down to a power of two buckets
+  std::size_t bytes() const { return buckets_.size() * sizeof(Bucket); }
   void   clear();
 
+  // Call once before each search (not while threads are probing).
+  void   new_search() { ++generation_; }
+
   // Returns true if an entry with matching key exists (copied into out)
   bool   probe(U64 key, TTEntry& out) const;
 
-  // Store or replace
+  // Store or replace (same key: unless the stored entry is from this search
+  // and deeper by more than 2 plies, and the new one is not exact)
   void   store(U64 key, const Move& best, std::int16_t depth,
                std::int16_t score, TTBound bound);
 
+  // Permille of sampled slots (first 1000) written during the current search.
+  int    hashfull() const;
+
 private:
-  std::vector<TTEntry> entries_;
+  struct alignas(64) Bucket {
+    std::atomic<U64> e[BUCKET_ENTRIES]; // 0 = empty (see tt.cpp for the layout)
+  };
+  static_assert(sizeof(Bucket) == 64, "TT bucket must fill one cache line");
+
+  std::vector<Bucket> buckets_;
   std::size_t mask_ = 0;
+  std::uint8_t generation_ = 0;
 
   std::size_t index(U64 key) const { return static_cast<std::size_t>(key) & mask_; }
-  void ensure_pow2(std::size_t& n);
 };
 
 } // namespace euclid
@@ -1,98 +1,127 @@
 #include "euclid/attack.hpp"
 #include "euclid/types.hpp"
 #include "euclid/board.hpp"
-#include <cstdlib> // std::abs
+#include "euclid/attacks_tbl.hpp"
+#include "euclid/bitboard.hpp"
 
 namespace euclid {
 
-static inline bool on_board(int s) { return s >= 0 && s < 64; }
 static inline Color other(Color c) { return c == Color::White ? Color::Black : Color::White; }
 
+U64 attackers_to(const Board& b, Square s, U64 occ) {
+  const auto& T = ATT();
+  const std::size_t si = static_cast<std::size_t>(s);
+  const U64 diag = b.pieces(Color::White, Piece::Bishop) | b.pieces(Color::Black, Piece::Bishop)
+                 | b.pieces(Color::White, Piece::Queen)  | b.pieces(Color::Black, Piece::Queen);
+  const U64 orth = b.pieces(Color::White, Piece::Rook)   | b.pieces(Color::Black, Piece::Rook)
+                 | b.pieces(Color::White, Piece::Queen)  | b.pieces(Color::Black, Piece::Queen);
+
+  // A white pawn attacks s iff it sits on a square a black pawn on s would attack (and vice versa).
+  return (T.pawn_att[static_cast<std::size_t>(Color::Black)][si] & b.pieces(Color::White, Piece::Pawn))
+       | (T.pawn_att[static_cast<std::size_t>(Color::White)][si] & b.pieces(Color::Black, Piece::Pawn))
+       | (T.knight_att[si] & (b.pieces(Color::White, Piece::Knight) | b.pieces(Color::Black, Piece::Knight)))
+       | (T.king_att[si]   & (b.pieces(Color::White, Piece::King)   | b.pieces(Color::Black, Piece::King)))
+       | (bishop_attacks(s, occ) & diag)
+       | (rook_attacks(s, occ)   & orth);
+}
+
 bool square_attacked(const Board& b, Square s, Color by) {
-  // Knights: sources that can jump to s
-  {
-    static constexpr int KN_OFF[8] = {+17,+15,+10,+6,-6,-10,-15,-17};
-    const int fS = file_of(s), rS = rank_of(s);
-    for (int d : KN_OFF) {
-      const int q = s + d;
-      if (!on_board(q)) continue;
-      const int df = std::abs(file_of(q) - fS);
-      const int dr = std::abs(rank_of(q) - rS);
-      if (!((df == 1 && dr == 2) || (df == 2 && dr == 1))) continue;
-      Color c; Piece p = b.piece_at(q, &c);
-      if (p == Piece::Knight && c == by) return true;
-    }
-  }
+  return by == Color::White ? square_attacked<Color::White>(b, s)
+                            : square_attacked<Color::Black>(b, s);
+}
+
+bool in_check(const Board& b, Color side) {
+  if (side == b.side_to_move()) return b.checkers() != 0ULL; // cached per position
+  const Square ks = b.king_square(side);
+  if (ks < 0) return false; // fail-safe for odd test setups
+  return square_attacked(b, ks, other(side));
+}
+
+CheckSquares check_squares(const Board& b) {
+  CheckSquares cs{};
+  const Color us   = b.side_to_move();
+  const Color them = other(us);
+  cs.ksq = b.king_square(them);
+  if (cs.ksq < 0) return cs;
+
+  const auto& T = ATT();
+  const std::size_t ki = static_cast<std::size_t>(cs.ksq);
+  const U64 occ = b.occupancy();
+  auto& sq = cs.squares;
+  sq[static_cast<std::size_t>(Piece::Pawn)]   = T.pawn_att[static_cast<std::size_t>(them)][ki];
+  sq[static_cast<std::size_t>(Piece::Knight)] = T.knight_att[ki];
+  sq[static_cast<std::size_t>(Piece::Bishop)] = bishop_attacks(cs.ksq, occ);
+  sq[static_cast<std::size_t>(Piece::Rook)]   = rook_attacks(cs.ksq, occ);
+  sq[static_cast<std::size_t>(Piece::Queen)]  = sq[static_cast<std::size_t>(Piece::Bishop)]
+                                              | sq[static_cast<std::size_t>(Piece::Rook)];
+  sq[static_cast<std::size_t>(Piece::King)]   = 0ULL; // a king never checks directly
 
-  // King: adjacent sources
-  {
-    const int fS = file_of(s), rS = rank_of(s);
-    for (int df = -1; df <= 1; ++df) for (int dr = -1; dr <= 1; ++dr) {
-      if (!df && !dr) continue;
-      const int f = fS + df, r = rS + dr;
-      if (f < 0 || f > 7 || r < 0 || r > 7) continue;
-      const int q = r * 8 + f;
-      Color c; Piece p = b.piece_at(q, &c);
-      if (p == Piece::King && c == by) return true;
+  // Discovered-check candidates: our sliders aimed at ksq with exactly one piece,
+  // also ours, in between (same scan as pins, seen from the other king).
+  const U64 queens = b.pieces(us, Piece::Queen);
+  U64 snipers = (bishop_attacks(cs.ksq, 0ULL) & (b.pieces(us, Piece::Bishop) | queens))
+              | (rook_attacks(cs.ksq, 0ULL)   & (b.pieces(us, Piece::Rook)   | queens));
+  while (snipers) {
+    const Square s = pop_lsb(snipers);
+    const U64 blockers = T.between[ki][static_cast<std::size_t>(s)] & occ;
+    if (blockers && !(blockers & (blockers - 1ULL)) && (blockers & b.occupancy(us))) {
+      cs.discovered |= blockers;
     }
   }
+  return cs;
+}
+
+bool gives_check(const Board& b, const Move& m, const CheckSquares& cs) {
+  if (cs.ksq < 0) return false;
+  const Color us = b.side_to_move();
+  const Square from = m.from();
+  const Square to   = m.to();
+  const Piece  pc   = b.piece_at(from);
+  const std::size_t ki = static_cast<std::size_t>(cs.ksq);
+
+  // Direct check from the destination
+  if (!m.is_promotion() && (cs.squares[static_cast<std::size_t>(pc)] & square_bb(to))) return true;
+
+  // Discovered check: the mover leaves the line between a slider and the king
+  if ((cs.discovered & square_bb(from)) &&
+      !(ATT().line[ki][static_cast<std::size_t>(from)] & square_bb(to))) return true;
 
-  // Pawns: sources that capture into s
-  if (by == Color::White) {
-    if (file_of(s) > 0)  { int q = s - 9; if (on_board(q)) { Color c; Piece p = b.piece_at(q, &c); if (p == Piece::Pawn && c == by) return true; } }
-    if (file_of(s) < 7)  { int q = s - 7; if (on_board(q)) { Color c; Piece p = b.piece_at(q, &c); if (p == Piece::Pawn && c == by) return true; } }
-  } else {
-    if (file_of(s) > 0)  { int q = s + 7; if (on_board(q)) { Color c; Piece p = b.piece_at(q, &c); if (p == Piece::Pawn && c == by) return true; } }
-    if (file_of(s) < 7)  { int q = s + 9; if (on_board(q)) { Color c; Piece p = b.piece_at(q, &c); if (p == Piece::Pawn && c == by) return true; } }
+  switch (m.flags()) {
+  case MoveFlag::Quiet:
+  case MoveFlag::DoublePush:
+  case MoveFlag::Capture:
+    return false;
+
+  case MoveFlag::EnPassant: {
+    // The captured pawn may have been the only blocker of one of our sliders.
+    const Square cap = to + (us == Color::White ? -8 : +8);
+    const U64 occ = (b.occupancy() ^ square_bb(from) ^ square_bb(cap)) | square_bb(to);
+    const U64 queens = b.pieces(us, Piece::Queen);
+    return ((bishop_attacks(cs.ksq, occ) & (b.pieces(us, Piece::Bishop) | queens)) |
+            (rook_attacks(cs.ksq, occ)   & (b.pieces(us, Piece::Rook)   | queens))) != 0ULL;
   }
 
-  // Sliders from s outward: first blocker decides
-  // Diagonals -> bishop/queen
-  {
-    static constexpr int DF[4] = {+1, +1, -1, -1};
-    static constexpr int DR[4] = {+1, -1, +1, -1};
-    for (int dir = 0; dir < 4; ++dir) {
-      int f = file_of(s) + DF[dir], r = rank_of(s) + DR[dir];
-      while (f >= 0 && f < 8 && r >= 0 && r < 8) {
-        const int q = r * 8 + f;
-        Color c; Piece p = b.piece_at(q, &c);
-        if (p != Piece::None) {
-          if (c == by && (p == Piece::Bishop || p == Piece::Queen)) return true;
-          break;
-        }
-        f += DF[dir]; r += DR[dir];
-      }
-    }
+  case MoveFlag::Castle: {
+    // Only the rook can check; the king square it slides past is vacated.
+    const bool kingSide = to > from;
+    const Square rookFrom = kingSide ? from + 3 : from - 4;
+    const Square rookTo   = kingSide ? from + 1 : from - 1;
+    const U64 occ = (b.occupancy() ^ square_bb(from) ^ square_bb(rookFrom))
+                  | square_bb(to) | square_bb(rookTo);
+    return (rook_attacks(rookTo, occ) & square_bb(cs.ksq)) != 0ULL;
   }
-  // Orthogonals -> rook/queen
-  {
-    static constexpr int DF[4] = {+1, -1,  0,  0}; // E, W,  -,  -
-    static constexpr int DR[4] = { 0,  0, +1, -1}; // -,  -,  N,  S
-    for (int dir = 0; dir < 4; ++dir) {
-      int f = file_of(s) + DF[dir], r = rank_of(s) + DR[dir];
-      while (f >= 0 && f < 8 && r >= 0 && r < 8) {
-        const int q = r * 8 + f;
-        Color c; Piece p = b.piece_at(q, &c);
-        if (p != Piece::None) {
-          if (c == by && (p == Piece::Rook || p == Piece::Queen)) return true;
-          break;
-        }
-        f += DF[dir]; r += DR[dir];
-      }
+
+  default: {
+    // Promotion: the new piece attacks through the square the pawn just left.
+    const U64 occ = b.occupancy() ^ square_bb(from);
+    switch (m.promo()) {
+    case Piece::Knight: return (ATT().knight_att[static_cast<std::size_t>(to)] & square_bb(cs.ksq)) != 0ULL;
+    case Piece::Bishop: return (bishop_attacks(to, occ) & square_bb(cs.ksq)) != 0ULL;
+    case Piece::Rook:   return (rook_attacks(to, occ)   & square_bb(cs.ksq)) != 0ULL;
+    default:            return (queen_attacks(to, occ)  & square_bb(cs.ksq)) != 0ULL;
     }
   }
-
-  return false;
-}
-
-bool in_check(const Board& b, Color side) {
-  int ks = -1;
-  for (int s = 0; s < 64; ++s) {
-    Color c; Piece p = b.piece_at(s, &c);
-    if (p == Piece::King && c == side) { ks = s; break; }
   }
-  if (ks < 0) return false; // fail-safe for odd test setups
-  return square_attacked(b, ks, other(side));
 }
 
 } // namespace euclid
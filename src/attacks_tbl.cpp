@@ -1,13 +1,18 @@
 #include "euclid/attacks_tbl.hpp"
 
+#include <cstddef>
+
+#if EUCLID_HAS_PEXT
+#include <cpuid.h>
+#endif
 
 namespace euclid {
 
-static inline int file_of(int s){ return s & 7; }
-static inline int rank_of(int s){ return s >> 3; }
-static inline bool on_board(int s){ return s >= 0 && s < 64; }
+static constexpr bool on_board(int s){ return s >= 0 && s < 64; }
+static constexpr int iabs(int x){ return x < 0 ? -x : x; } // std::abs is not constexpr in C++20
 
-static AttackTables build() {
+// Evaluated by the compiler: the result is emitted as read-only data.
+static constexpr AttackTables build() {
   AttackTables T{};
 
   // Knight moves (relative)
@@ -19,8 +24,8 @@ static AttackTables build() {
     for (int d : KN_OFF) {
       int t = s + d;
       if (!on_board(t)) continue;
-      int df = std::abs(file_of(t) - f0);
-      int dr = std::abs(rank_of(t) - r0);
+      int df = iabs(file_of(t) - f0);
+      int dr = iabs(rank_of(t) - r0);
       if (!((df == 1 && dr == 2) || (df == 2 && dr == 1))) continue;
       T.knight_to[ss][n++] = t;
     }
@@ -66,12 +71,203 @@ static AttackTables build() {
     push_ray(s, -1,+1, DIR_NW);
   }
 
+  // Bitboard forms
+  for (int s = 0; s < 64; ++s) {
+    const size_t ss = static_cast<size_t>(s);
+    for (size_t i = 0; i < T.knight_sz[ss]; ++i) T.knight_att[ss] |= 1ULL << T.knight_to[ss][i];
+    for (size_t i = 0; i < T.king_sz[ss]; ++i)   T.king_att[ss]   |= 1ULL << T.king_to[ss][i];
+
+    const int f = file_of(s), r = rank_of(s);
+    if (r < 7) {
+      if (f > 0) T.pawn_att[0][ss] |= 1ULL << (s + 7);
+      if (f < 7) T.pawn_att[0][ss] |= 1ULL << (s + 9);
+    }
+    if (r > 0) {
+      if (f > 0) T.pawn_att[1][ss] |= 1ULL << (s - 9);
+      if (f < 7) T.pawn_att[1][ss] |= 1ULL << (s - 7);
+    }
+
+    for (size_t d = 0; d < 8; ++d) {
+      U64 full = 1ULL << s; // both half-rays (d and its opposite d ^ 2) plus s itself
+      for (size_t i = 0; i < T.ray_len[d][ss]; ++i)     full |= 1ULL << T.rays[d][ss][i];
+      for (size_t i = 0; i < T.ray_len[d ^ 2][ss]; ++i) full |= 1ULL << T.rays[d ^ 2][ss][i];
+
+      U64 acc = 0;
+      for (size_t i = 0; i < T.ray_len[d][ss]; ++i) {
+        const int t = T.rays[d][ss][i];
+        T.between[ss][static_cast<size_t>(t)] = acc;
+        T.line[ss][static_cast<size_t>(t)]    = full;
+        acc |= 1ULL << t;
+      }
+    }
+  }
+
   return T;
 }
 
-const AttackTables& ATT() {
-  static AttackTables T = build();
-  return T;
+constexpr AttackTables ATTACK_TABLES = build();
+
+// ---- Magic bitboards ----
+// Magics found offline with a sparse-random search (fixed seed); every square maps
+// its blocker subsets into 2^popcount(mask) slots without destructive collisions.
+static constexpr U64 ROOK_MAGICS[64] = {
+  0x008000908064c000ULL, 0x0040200040001000ULL, 0x0180100080a0010aULL, 0x8880041000800800ULL,
+  0x1200100201200804ULL, 0x0200020004011008ULL, 0x2180010000800600ULL, 0x0200005088210204ULL,
+  0x0400800040008021ULL, 0x0400400020005000ULL, 0x8240801000200080ULL, 0x8611001004200900ULL,
+  0x008180800c001800ULL, 0x0100800200800400ULL, 0x0a02000102000408ULL, 0x8020802300104280ULL,
+  0x0080004000402000ULL, 0xe010104000402000ULL, 0x0800808010002000ULL, 0xa280210008100100ULL,
+  0x0001818014000800ULL, 0xa002010100080400ULL, 0x0080240001020870ULL, 0x0001020004048845ULL,
+  0x0081826280004004ULL, 0x2020810900284000ULL, 0x0200100080802000ULL, 0x0200080080100080ULL,
+  0x8083080100100500ULL, 0x4406000901000400ULL, 0x0005020080800100ULL, 0x0090204200008114ULL,
+  0x0010400094800420ULL, 0x0900804000802002ULL, 0x0201001841002000ULL, 0x4100080080801000ULL,
+  0x4540040080800800ULL, 0x0002001004040020ULL, 0x0281195814001002ULL, 0x1240800040800100ULL,
+  0x0880042000524004ULL, 0x02c080410206002cULL, 0x0801200241050010ULL, 0x8400080010008080ULL,
+  0x0008000500090010ULL, 0x0082009084020008ULL, 0x4012000108020004ULL, 0x9000104d08860004ULL,
+  0x2004204114800100ULL, 0x0148802112400300ULL, 0x0202842000100880ULL, 0x001b080080900080ULL,
+  0x001a002008100600ULL, 0x0004008004020080ULL, 0x5181000600040300ULL, 0x0000044401128a00ULL,
+  0x8044110480002441ULL, 0x2008110084402202ULL, 0x90806005090010c1ULL, 0x000420310a004a42ULL,
+  0x0023001004020801ULL, 0x0882001008040102ULL, 0x000230088118020cULL, 0x0000019025040042ULL,
+};
+
+static constexpr U64 BISHOP_MAGICS[64] = {
+  0x0045010808008680ULL, 0x2002080204004898ULL, 0x0210009a10400006ULL, 0x0824050200810200ULL,
+  0x0006061105004090ULL, 0x00010108c0000000ULL, 0x0814040282104004ULL, 0x0012012201106800ULL,
+  0x10823014100c1040ULL, 0x0080c2088802808cULL, 0x0281108410404000ULL, 0x0101212041826200ULL,
+  0x0020141028221058ULL, 0x2201020202200202ULL, 0x000082a801482000ULL, 0x0000008401411044ULL,
+  0x0007103014300404ULL, 0x0002091110010100ULL, 0x42140012040c0808ULL, 0x0800808802004020ULL,
+  0x90c4004210140000ULL, 0x0800200900a01000ULL, 0x00d0400201108810ULL, 0x80820183814412a0ULL,
+  0x00a01008202202b4ULL, 0x01c2021a09500402ULL, 0x0084440208042400ULL, 0x800400400c090100ULL,
+  0xba10040010802100ULL, 0xd182009006005000ULL, 0x5011021001009004ULL, 0x0020420200510400ULL,
+  0x0292104000468800ULL, 0x00043009091c0500ULL, 0x0280441000020025ULL, 0x0042820080080080ULL,
+  0x0440101010010040ULL, 0x1000900100808080ULL, 0x0108108120089800ULL, 0x0044010200012682ULL,
+  0xc002500420900400ULL, 0x0040482210710800ULL, 0x0002060024000200ULL, 0x0281020a44000800ULL,
+  0xa0021200a4000200ULL, 0x0001301000840840ULL, 0x2868500108444220ULL, 0x0004111041000200ULL,
+  0x8044020842080200ULL, 0x0000220104210200ULL, 0x0000021201044000ULL, 0x0000280884040028ULL,
+  0x4012114010858003ULL, 0x0000081004082b88ULL, 0x3892700508208002ULL, 0x00220a041b060400ULL,
+  0x0812020284014881ULL, 0x010434a282103100ULL, 0x0490400824020800ULL, 0x4a20002c00208800ULL,
+  0x000000a011020200ULL, 0x4002940a02482202ULL, 0x5100100202140406ULL, 0x02102000840540c1ULL,
+};
+
+// Reference ray walk (first blocker included). With edges=false this yields the
+// relevant-occupancy mask instead: the last square of every ray is dropped.
+static U64 slide(int s, U64 occ, const int (&df)[4], const int (&dr)[4], bool edges) {
+  U64 out = 0;
+  for (int d = 0; d < 4; ++d) {
+    int f = file_of(s) + df[d], r = rank_of(s) + dr[d];
+    while (f >= 0 && f < 8 && r >= 0 && r < 8) {
+      const int nf = f + df[d], nr = r + dr[d];
+      if (!edges && !(nf >= 0 && nf < 8 && nr >= 0 && nr < 8)) break;
+      const U64 bit = 1ULL << (r * 8 + f);
+      out |= bit;
+      if (occ & bit) break;
+      f = nf; r = nr;
+    }
+  }
+  return out;
+}
+
+static constexpr int ROOK_DF[4]   = {+1, -1,  0,  0};
+static constexpr int ROOK_DR[4]   = { 0,  0, +1, -1};
+static constexpr int BISHOP_DF[4] = {+1, +1, -1, -1};
+static constexpr int BISHOP_DR[4] = {+1, -1, +1, -1};
+
+static void init_magics(std::array<Magic,64>& M, U64* table, unsigned& offset,
+                        const U64 (&magics)[64], const int (&df)[4], const int (&dr)[4],
+                        SliderBackend be) {
+  for (int s = 0; s < 64; ++s) {
+    Magic& m = M[static_cast<std::size_t>(s)];
+    m.mask   = slide(s, 0ULL, df, dr, /*edges=*/false);
+    m.magic  = magics[s];
+    m.shift  = static_cast<unsigned>(64 - __builtin_popcountll(m.mask));
+    m.offset = offset;
+
+    // Carry-Rippler walk over every subset of the mask. It counts up in pext
+    // order, so 'n' is the pext index of 'sub'.
+    U64 sub = 0;
+    std::size_t n = 0;
+    do {
+      const std::size_t idx = be == SliderBackend::Pext ? n : m.index(sub);
+      table[offset + idx] = slide(s, sub, df, dr, /*edges=*/true);
+      sub = (sub - m.mask) & m.mask;
+      ++n;
+    } while (sub);
+
+    offset += 1u << (64 - m.shift);
+  }
+}
+
+static void layout_sliders(SliderTables& T, SliderBackend be) {
+  unsigned offset = 0;
+  init_magics(T.rook,   T.table.data(), offset, ROOK_MAGICS,   ROOK_DF,   ROOK_DR,   be);
+  init_magics(T.bishop, T.table.data(), offset, BISHOP_MAGICS, BISHOP_DF, BISHOP_DR, be);
+}
+
+constinit SliderTables SLIDER_TABLES{};
+constinit SliderBackend SLIDER_BACKEND = SliderBackend::Magic;
+
+static constinit bool SLIDERS_BUILT = false;
+
+// Static initialization is single-threaded, so a plain flag is enough.
+SliderInit::SliderInit() {
+  if (SLIDERS_BUILT) return;
+  SLIDERS_BUILT = true;
+  SLIDER_BACKEND = detect_slider_backend();
+  layout_sliders(SLIDER_TABLES, SLIDER_BACKEND);
+}
+
+U64 ray_bishop_attacks(int s, U64 occ) { return slide(s, occ, BISHOP_DF, BISHOP_DR, /*edges=*/true); }
+U64 ray_rook_attacks(int s, U64 occ)   { return slide(s, occ, ROOK_DF,   ROOK_DR,   /*edges=*/true); }
+
+// ---- CPU dispatch ----
+static bool cpu_fast_pext() {
+#if EUCLID_HAS_PEXT
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+  if (!(ebx & (1u << 8))) return false; // BMI2
+
+  // AMD Zen 1/2 (family 0x17) implement PEXT in microcode (~250 cycles);
+  // magics are much faster there even though BMI2 is reported.
+  if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx)) return false;
+  const bool amd = (ebx == 0x68747541u); // "Auth"enticAMD
+  if (amd && __get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    const unsigned family = ((eax >> 8) & 0xFu) + ((eax >> 20) & 0xFFu);
+    if (family < 0x19u) return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+SliderBackend detect_slider_backend() {
+  static const bool pext = cpu_fast_pext();
+  return pext ? SliderBackend::Pext : SliderBackend::Magic;
+}
+
+bool slider_backend_supported(SliderBackend be) {
+  if (be != SliderBackend::Pext) return true;
+#if EUCLID_HAS_PEXT
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 8));
+#else
+  return false;
+#endif
+}
+
+const char* slider_backend_name(SliderBackend be) {
+  switch (be) {
+    case SliderBackend::Pext:  return "pext";
+    case SliderBackend::Magic: return "magic";
+    case SliderBackend::Ray:   return "ray";
+  }
+  return "unknown";
+}
+
+bool set_slider_backend(SliderBackend be) {
+  if (!slider_backend_supported(be)) return false;
+  if (be != SliderBackend::Ray && be != SLIDER_BACKEND) layout_sliders(SLIDER_TABLES, be);
+  SLIDER_BACKEND = be;
+  return true;
 }
 
 } // namespace euclid
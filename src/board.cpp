@@ -1,4 +1,6 @@
 #include "euclid/board.hpp"
+#include "euclid/attacks_tbl.hpp"
+#include "euclid/bitboard.hpp"
 
 #include <cassert>
 #include <cstddef>
@@ -8,7 +10,7 @@ namespace euclid {
 namespace {
 
 // Deterministic SplitMix64 for Zobrist initialization.
-static inline std::uint64_t splitmix64_next(std::uint64_t& x) {
+static constexpr std::uint64_t splitmix64_next(std::uint64_t& x) {
   x += 0x9e3779b97f4a7c15ULL;
   std::uint64_t z = x;
   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
@@ -16,7 +18,7 @@ static inline std::uint64_t splitmix64_next(std::uint64_t& x) {
   return z ^ (z >> 31);
 }
 
-static Zobrist make_zobrist_table() {
+static constexpr Zobrist make_zobrist_table() {
   Zobrist Z{};
   std::uint64_t seed = 0x1234abcd5678ef01ULL; // fixed seed => deterministic hashes
 
@@ -42,10 +44,7 @@ static Zobrist make_zobrist_table() {
 
 } // namespace
 
-const Zobrist& zobrist() {
-  static const Zobrist Z = make_zobrist_table();
-  return Z;
-}
+constexpr Zobrist ZOBRIST_TABLE = make_zobrist_table();
 
 Board::Board() {
   clear();
@@ -57,6 +56,10 @@ void Board::clear() {
       bb_[c][p] = 0ULL;
     }
   }
+  mailbox_.fill(EMPTY_);
+  occ_.fill(0ULL);
+  king_sq_.fill(-1);
+  check_info_valid_ = false;
 
   stm_ = Color::White;
   castling_.rights = 0;
@@ -78,6 +81,10 @@ void Board::set_piece(Color c, Piece p, Square s) {
 #endif
 
   bb_[ci][pi] |= mask;
+  occ_[ci] |= mask;
+  mailbox_[static_cast<std::size_t>(s)] = code_(c, p);
+  if (p == Piece::King) king_sq_[ci] = s;
+  check_info_valid_ = false;
   hash_ ^= zobrist().piece_on[ci][pi][static_cast<std::size_t>(s)];
 }
 
@@ -91,23 +98,43 @@ void Board::remove_piece(Color c, Piece p, Square s) {
 #endif
 
   bb_[ci][pi] &= ~mask;
+  occ_[ci] &= ~mask;
+  mailbox_[static_cast<std::size_t>(s)] = EMPTY_;
+  if (p == Piece::King && king_sq_[ci] == s) king_sq_[ci] = -1;
+  check_info_valid_ = false;
   hash_ ^= zobrist().piece_on[ci][pi][static_cast<std::size_t>(s)];
 }
 
-Piece Board::piece_at(Square s, Color* c_out) const {
-  const U64 mask = 1ULL << static_cast<unsigned>(s);
-
-  for (std::size_t c = 0; c < COLOR_N; ++c) {
-    for (std::size_t p = 0; p < PIECE_N; ++p) {
-      if (bb_[c][p] & mask) {
-        if (c_out) *c_out = static_cast<Color>(c);
-        return static_cast<Piece>(p);
-      }
+void Board::refresh_check_info_() const {
+  const Color us   = stm_;
+  const Color them = (us == Color::White) ? Color::Black : Color::White;
+  const Square ks  = king_square(us);
+
+  checkers_ = 0ULL;
+  pinned_   = 0ULL;
+  check_info_valid_ = true;
+  if (ks < 0) return;
+
+  const auto& T = ATT();
+  const std::size_t ksi = static_cast<std::size_t>(ks);
+  const U64 occ = occupancy();
+  const U64 diag = pieces(them, Piece::Bishop) | pieces(them, Piece::Queen);
+  const U64 orth = pieces(them, Piece::Rook)   | pieces(them, Piece::Queen);
+
+  checkers_ = (T.knight_att[ksi] & pieces(them, Piece::Knight))
+            | (T.pawn_att[static_cast<std::size_t>(us)][ksi] & pieces(them, Piece::Pawn))
+            | (bishop_attacks(ks, occ) & diag)
+            | (rook_attacks(ks, occ) & orth);
+
+  // Pins: enemy sliders aimed at the king with exactly one piece (ours) in between.
+  U64 snipers = (bishop_attacks(ks, 0ULL) & diag) | (rook_attacks(ks, 0ULL) & orth);
+  while (snipers) {
+    const Square s = pop_lsb(snipers);
+    const U64 blockers = T.between[ksi][static_cast<std::size_t>(s)] & occ;
+    if (blockers && !(blockers & (blockers - 1ULL)) && (blockers & occupancy(us))) {
+      pinned_ |= blockers;
     }
   }
-
-  if (c_out) *c_out = Color::White;
-  return Piece::None;
 }
 
 void Board::recompute_hash_() {
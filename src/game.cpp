@@ -13,34 +13,30 @@ namespace euclid {
 namespace {
 
 static inline bool is_null_move(const Move& m) {
-  return m.from == 0 && m.to == 0 && m.promo == Piece::None;
+  return m.is_null();
 }
 
-static bool is_legal_move(Board& b, const Move& m) {
-  const Color us = b.side_to_move();
-  State st{};
-  do_move(b, m, st);
-  const bool ok = !in_check(b, us);
-  undo_move(b, m, st);
-  return ok;
+// Robust against arbitrary moves (e.g. a null move from an aborted search):
+// only moves present in the legal list are accepted.
+static bool is_legal_move(const Board& b, const Move& m) {
+  MoveList ml;
+  generate_legal(b, ml);
+  for (const auto& cand : ml) {
+    if (cand == m) return true;
+  }
+  return false;
 }
 
-static Move first_legal_move(Board& b) {
+static Move first_legal_move(const Board& b) {
   MoveList ml;
-  generate_pseudo_legal(b, ml);
-  for (const auto& m : ml) {
-    if (is_legal_move(b, m)) return m;
-  }
-  return Move{}; // "null"
+  generate_legal(b, ml);
+  return ml.empty() ? Move{} : ml.data[0]; // "null" when none
 }
 
-static bool has_any_legal(Board& b) {
+static bool has_any_legal(const Board& b) {
   MoveList ml;
-  generate_pseudo_legal(b, ml);
-  for (const auto& m : ml) {
-    if (is_legal_move(b, m)) return true;
-  }
-  return false;
+  generate_legal(b, ml);
+  return !ml.empty();
 }
 
 static inline GameOutcome winner_from_mated_side(Color stm) {
@@ -105,19 +101,10 @@ GameResult selfplay(Board start, int maxPlies, SearchLimits baseLimits) {
       break;
     }
 
-    // Play it
-    const Color us = b.side_to_move();
+    // Play it (legality was verified above against the legal move list)
     State st{};
     do_move(b, m, st);
 
-    // Assert legality invariant in debug-ish terms (still safe in Release).
-    if (in_check(b, us)) {
-      undo_move(b, m, st);
-      out.outcome = GameOutcome::Aborted;
-      out.reason = "selected move was illegal (king left in check)";
-      break;
-    }
-
     out.moves.push_back(m);
     hist.push_back(b.hash());
   }
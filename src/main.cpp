@@ -5,11 +5,14 @@
 #include <iomanip>
 #include <iostream>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "euclid/attack.hpp"
+#include "euclid/attacks_tbl.hpp"
+#include "euclid/bench.hpp"
 #include "euclid/board.hpp"
 #include "euclid/dataset.hpp"
 #include "euclid/encode.hpp"
@@ -24,6 +27,17 @@
 #include "euclid/types.hpp"
 #include "euclid/uci.hpp"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define EUCLID_HAS_SPAWN 1
+extern char** environ;
+#else
+#define EUCLID_HAS_SPAWN 0
+#endif
+
 using namespace euclid;
 
 static void usage() {
@@ -32,36 +46,58 @@ static void usage() {
     "Usage:\n"
     "  euclid_cli uci\n"
     "\n"
-    "  euclid_cli perft <depth> [fen...]\n"
-    "  euclid_cli divide <depth> [fen...]\n"
+    "  euclid_cli perft <depth> [hash <MB>] [threads <N>] [split <plies>] [fen...]\n"
+    "  euclid_cli divide <depth> [hash <MB>] [threads <N>] [split <plies>] [fen...]\n"
     "\n"
     "  euclid_cli eval [fen...]\n"
     "  euclid_cli eval nn <model_path> [fen...]\n"
     "  euclid_cli eval ort <model.onnx> [fen...]\n"
     "\n"
     "  euclid_cli search [nn <model_path> | ort <model.onnx>] [depth <N>] [nodes <N>] [movetime <ms>]\n"
-    "                  [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>]\n"
+    "                  [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>] [threads <N>]\n"
     "                  [fen <FEN...>]\n"
     "\n"
     "  euclid_cli nn_make_const <out_path> <cp>\n"
     "\n"
     "  euclid_cli selfplay [nn <model_path> | ort <model.onnx>] [maxplies <N>] [depth <N>] [nodes <N>] [movetime <ms>]\n"
-    "                     [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>]\n"
+    "                     [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>] [threads <N>]\n"
     "                     [fen <FEN...>]\n"
     "\n"
     "  euclid_cli dataset selfplay <out_path> [games <N>] [maxplies <N>] [include_aborted <0|1>]\n"
     "                     [nn <model_path> | ort <model.onnx>] [depth <N>] [nodes <N>] [movetime <ms>]\n"
-    "                     [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>]\n"
+    "                     [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>] [threads <N>]\n"
     "                     [fen <FEN...>]\n"
     "\n"
-    "  euclid_cli bench perft <depth> [iters <N>] [fen <FEN...>]\n"
+    "  euclid_cli bench perft <depth> [iters <N>] [hash <MB>] [threads <N>] [split <plies>]\n"
+    "                       [backend <auto|pext|magic|ray>] [fen <FEN...>]\n"
     "  euclid_cli bench search [nn <model_path> | ort <model.onnx>] [iters <N>] [depth <N>] [nodes <N>] [movetime <ms>]\n"
-    "                        [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>]\n"
+    "                        [wtime <ms> btime <ms> winc <ms> binc <ms> movestogo <N>] [threads <N>]\n"
     "                        [fen <FEN...>]\n"
+    "  euclid_cli bench perftsuite <file.epd> [maxdepth <N>] [hash <MB>] [threads <N>] [split <plies>]\n"
+    "                            [json <path|->]\n"
+    "  euclid_cli bench startup [iters <N>]\n"
+    "  euclid_cli bench [signature [depth <N>] [quiet]]\n"
     "\n"
     "Notes:\n"
     "  - If FEN omitted, uses startpos.\n"
-    "  - 'bench search' reports time + NPS based on SearchResult.nodes.\n";
+    "  - 'hash <MB>' gives perft a (key, depth) -> count cache; leaf moves are always bulk-counted.\n"
+    "  - 'threads <N>' splits perft over N workers (one shared hash); 'split <plies>' sets how\n"
+    "    many plies are expanded into work items (default: 1, or 2 if there are few root moves).\n"
+    "  - 'bench search' reports time + NPS based on SearchResult.nodes; 'search' and 'bench search'\n"
+    "    also print hashfull (permille of the TT written by the search).\n"
+    "  - 'threads <N>' on search-like commands runs a Lazy SMP search: N-1 helper threads share\n"
+    "    the TT; the main thread's move is reported, nodes counts every thread. A 'nodes <N>'\n"
+    "    limit makes the search single-threaded so the limit stays exact.\n"
+    "  - 'bench perft ... backend <name>' forces a slider-attack backend and reports the one used\n"
+    "    ('auto' = CPUID pick: pext on fast-BMI2 CPUs, else magic).\n"
+    "  - 'bench perftsuite' runs every ';D<depth> <nodes>' entry of an EPD file (up to maxdepth),\n"
+    "    reports nodes/time/nps per run and in total, and exits with status 3 on any mismatch.\n"
+    "    'json <path>' also writes the results as JSON ('-' = stdout only).\n"
+    "  - 'bench' / 'bench signature' searches the built-in positions to a fixed depth (default 7),\n"
+    "    each from a cold search_reset(); total nodes is the signature: same nodes = same search,\n"
+    "    so only nps may differ between speed-only changes.\n"
+    "  - 'bench startup' launches 'euclid_cli perft 1' N times and reports the average wall time\n"
+    "    per process (loader + static init + one movegen), i.e. the cost of a short-lived run.\n";
 }
 
 static std::string join_from(const std::vector<std::string>& a, size_t i) {
@@ -89,6 +125,31 @@ static int to_int(const std::string& s) {
   return std::stoi(s);
 }
 
+// Optional "hash <MB>", "threads <N>" and "split <plies>" right after the
+// perft/divide depth, in any order; advances 'next' past them.
+struct ParsedPerftArgs {
+  std::optional<PerftTT> tt;
+  PerftOptions opt{};
+};
+
+static void parse_perft_args(const std::vector<std::string>& a, size_t& next, ParsedPerftArgs& p) {
+  while (next + 1 < a.size()) {
+    const std::string& k = a[next];
+    if (k == "hash") {
+      const int mb = std::max(0, std::stoi(a[next + 1]));
+      if (mb > 0) p.tt.emplace(static_cast<std::size_t>(mb) * 1024ULL * 1024ULL);
+    } else if (k == "threads") {
+      p.opt.threads = std::max(1, std::stoi(a[next + 1]));
+    } else if (k == "split") {
+      p.opt.split_depth = std::max(0, std::stoi(a[next + 1]));
+    } else {
+      break;
+    }
+    next += 2;
+  }
+  p.opt.tt = p.tt ? &*p.tt : nullptr;
+}
+
 static std::uint64_t to_u64(const std::string& s) {
   return static_cast<std::uint64_t>(std::stoull(s));
 }
@@ -122,6 +183,18 @@ static std::string fmt_cp(int cp) {
   return oss.str();
 }
 
+// Minimal JSON string escaping (FENs and file paths only need quotes/backslashes/control chars).
+static std::string json_str(const std::string& in) {
+  std::string out = "\"";
+  for (char c : in) {
+    if (c == '"' || c == '\\') { out.push_back('\\'); out.push_back(c); }
+    else if (static_cast<unsigned char>(c) < 0x20) out.push_back(' ');
+    else out.push_back(c);
+  }
+  out.push_back('"');
+  return out;
+}
+
 // ---------------- Search limits parsing ----------------
 
 struct ParsedSearchArgs {
@@ -152,7 +225,8 @@ static bool load_ort_or_die(const std::string& modelPath) {
 }
 
 // Parses a “search-like” argument list that starts at args[startIdx] (exclusive of the command itself).
-// Recognizes: nn <path>, ort <path>, depth, nodes, movetime, wtime/btime/winc/binc/movestogo, fen <FEN...>, iters <N> (optional).
+// Recognizes: nn <path>, ort <path>, depth, nodes, movetime, wtime/btime/winc/binc/movestogo, threads,
+// fen <FEN...>, iters <N> (optional).
 static ParsedSearchArgs parse_search_like(const std::vector<std::string>& args, size_t startIdx) {
   ParsedSearchArgs out{};
   out.lim.depth = 2; // preserve prior default behavior
@@ -205,6 +279,7 @@ static ParsedSearchArgs parse_search_like(const std::vector<std::string>& args,
     if (tok == "winc")       { out.lim.winc_ms = to_int(val); ++i; continue; }
     if (tok == "binc")       { out.lim.binc_ms = to_int(val); ++i; continue; }
     if (tok == "movestogo")  { out.lim.movestogo = to_int(val); ++i; continue; }
+    if (tok == "threads")    { out.lim.threads = std::clamp(to_int(val), 1, 256); ++i; continue; }
   }
 
   return out;
@@ -220,6 +295,29 @@ static const char* outcome_str(GameOutcome o) {
   }
 }
 
+#if EUCLID_HAS_SPAWN
+// Runs "<exe> perft 1" with output discarded; returns wall seconds or -1 on failure.
+static double time_child_process(const std::string& exe) {
+  std::string a0 = exe, a1 = "perft", a2 = "1";
+  char* const childArgv[] = {a0.data(), a1.data(), a2.data(), nullptr};
+
+  posix_spawn_file_actions_t fa;
+  posix_spawn_file_actions_init(&fa);
+  posix_spawn_file_actions_addopen(&fa, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+
+  const auto t0 = std::chrono::steady_clock::now();
+  pid_t pid = 0;
+  const int rc = posix_spawn(&pid, exe.c_str(), &fa, nullptr, childArgv, environ);
+  posix_spawn_file_actions_destroy(&fa);
+  if (rc != 0) return -1.0;
+
+  int status = 0;
+  if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) return -1.0;
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count();
+}
+#endif
+
 int main(int argc, char** argv) {
   std::vector<std::string> args(argv + 1, argv + argc);
   if (args.empty()) { usage(); return 0; }
@@ -262,23 +360,29 @@ int main(int argc, char** argv) {
     return 0;
   }
 
-  // perft <depth> [fen...]
+  // perft <depth> [hash <MB>] [threads <N>] [split <plies>] [fen...]
   if (cmd == "perft") {
     if (args.size() < 2) { usage(); return 1; }
     const int depth = to_int(args[1]);
-    Board b = board_from_args(args, 2);
-    const auto nodes = perft(b, depth);
+    size_t fenStart = 2;
+    ParsedPerftArgs pa;
+    parse_perft_args(args, fenStart, pa);
+    Board b = board_from_args(args, fenStart);
+    const auto nodes = perft(b, depth, pa.opt);
     std::cout << nodes << "\n";
     return 0;
   }
 
-  // divide <depth> [fen...]
+  // divide <depth> [hash <MB>] [threads <N>] [split <plies>] [fen...]
   if (cmd == "divide") {
     if (args.size() < 2) { usage(); return 1; }
     const int depth = to_int(args[1]);
-    Board b = board_from_args(args, 2);
+    size_t fenStart = 2;
+    ParsedPerftArgs pa;
+    parse_perft_args(args, fenStart, pa);
+    Board b = board_from_args(args, fenStart);
     std::vector<std::pair<Move, std::uint64_t>> parts;
-    perft_divide(b, depth, parts);
+    perft_divide(b, depth, parts, pa.opt);
     std::uint64_t total = 0;
     for (auto& [m, n] : parts) {
       std::cout << move_to_uci(m) << " " << n << "\n";
@@ -333,6 +437,7 @@ int main(int argc, char** argv) {
     std::cout << "best " << move_to_uci(r.best)
               << " score " << fmt_cp(r.score)
               << " nodes " << r.nodes
+              << " hashfull " << r.hashfull
               << " pv ";
     for (auto& m : r.pv) std::cout << move_to_uci(m) << ' ';
     std::cout << "\n";
@@ -450,11 +555,66 @@ int main(int argc, char** argv) {
     return 0;
   }
 
-  // bench perft <depth> [iters <N>] [fen <FEN...>]
+  // bench perft <depth> [iters <N>] [hash <MB>] [threads <N>] [split <plies>] [fen <FEN...>]
   // bench search [nn <model_path> | ort <model.onnx>] [iters <N>] [depth <N>] ... [fen <FEN...>]
+  // bench perftsuite <file.epd> [maxdepth <N>] [hash <MB>] [threads <N>] [split <plies>] [json <path|->]
+  // bench startup [iters <N>]
+  // bench [signature [depth <N>] [quiet]]
   if (cmd == "bench") {
-    if (args.size() < 2) { usage(); return 1; }
-    const std::string sub = args[1];
+    const std::string sub = (args.size() >= 2) ? args[1] : "signature";
+
+    if (sub == "signature") {
+      int depth = 7;
+      bool quiet = false;
+      for (size_t i = 2; i < args.size(); ++i) {
+        if (args[i] == "depth" && i + 1 < args.size()) { depth = std::max(1, to_int(args[i + 1])); ++i; }
+        else if (args[i] == "quiet") quiet = true;
+      }
+
+      const SearchBenchResult r = run_search_bench(depth, quiet ? nullptr : &std::cout);
+      const double nps = (r.seconds > 0.0) ? (static_cast<double>(r.nodes) / r.seconds) : 0.0;
+      std::cout << "bench signature depth " << depth
+                << " positions " << r.positions
+                << " nodes " << r.nodes
+                << " sec " << std::fixed << std::setprecision(6) << r.seconds
+                << " nps " << static_cast<std::uint64_t>(nps) << "\n";
+      return 0;
+    }
+
+    if (sub == "startup") {
+      int iters = 20;
+      for (size_t i = 2; i + 1 < args.size(); ++i) {
+        if (args[i] == "iters") { iters = std::max(1, to_int(args[i + 1])); ++i; }
+      }
+#if EUCLID_HAS_SPAWN
+      // Prefer the resolved binary path; argv[0] may be relative to a different PATH entry.
+      std::string exe = argv[0];
+      if (access("/proc/self/exe", X_OK) == 0) {
+        char buf[4096];
+        const ssize_t n = readlink("/proc/self/exe", buf, sizeof(buf) - 1);
+        if (n > 0) exe.assign(buf, static_cast<size_t>(n));
+      }
+
+      double totalSec = 0.0, minSec = 0.0;
+      for (int k = 0; k < iters; ++k) {
+        const double sec = time_child_process(exe);
+        if (sec < 0.0) {
+          std::cerr << "error: failed to launch " << exe << "\n";
+          return 2;
+        }
+        totalSec += sec;
+        if (k == 0 || sec < minSec) minSec = sec;
+      }
+
+      std::cout << "bench startup iters " << iters
+                << " avg_sec " << std::fixed << std::setprecision(6) << totalSec / static_cast<double>(iters)
+                << " min_sec " << minSec << "\n";
+      return 0;
+#else
+      std::cerr << "error: bench startup is not supported on this platform\n";
+      return 2;
+#endif
+    }
 
     if (sub == "perft") {
       if (args.size() < 3) { usage(); return 1; }
@@ -462,8 +622,12 @@ int main(int argc, char** argv) {
 
       int iters = 1;
       size_t fenStart = 3;
+      bool reportBackend = false;
+      int hashMb = 0;
+      PerftOptions opt{};
 
-      // Optional: iters <N> and/or fen <...>
+      // Optional: iters <N>, hash <MB>, threads <N>, split <plies>,
+      // backend <auto|pext|magic|ray> and/or fen <...>
       for (size_t i = 3; i < args.size(); ++i) {
         if (args[i] == "iters" && i + 1 < args.size()) {
           iters = std::max(1, to_int(args[i + 1]));
@@ -471,6 +635,43 @@ int main(int argc, char** argv) {
           fenStart = i + 1;
           continue;
         }
+        if (args[i] == "hash" && i + 1 < args.size()) {
+          hashMb = std::max(0, to_int(args[i + 1]));
+          ++i;
+          fenStart = i + 1;
+          continue;
+        }
+        if (args[i] == "threads" && i + 1 < args.size()) {
+          opt.threads = std::max(1, to_int(args[i + 1]));
+          ++i;
+          fenStart = i + 1;
+          continue;
+        }
+        if (args[i] == "split" && i + 1 < args.size()) {
+          opt.split_depth = std::max(0, to_int(args[i + 1]));
+          ++i;
+          fenStart = i + 1;
+          continue;
+        }
+        if (args[i] == "backend" && i + 1 < args.size()) {
+          const std::string& name = args[i + 1];
+          SliderBackend be = detect_slider_backend();
+          if      (name == "pext")  be = SliderBackend::Pext;
+          else if (name == "magic") be = SliderBackend::Magic;
+          else if (name == "ray")   be = SliderBackend::Ray;
+          else if (name != "auto") {
+            std::cerr << "error: unknown slider backend: " << name << "\n";
+            return 1;
+          }
+          if (!set_slider_backend(be)) {
+            std::cerr << "error: slider backend not supported on this CPU: " << name << "\n";
+            return 2;
+          }
+          reportBackend = true;
+          ++i;
+          fenStart = i + 1;
+          continue;
+        }
         if (args[i] == "fen") {
           fenStart = i + 1;
           break;
@@ -479,12 +680,17 @@ int main(int argc, char** argv) {
 
       Board b = board_from_args(args, fenStart);
 
+      std::optional<PerftTT> tt;
+      if (hashMb > 0) tt.emplace(static_cast<std::size_t>(hashMb) * 1024ULL * 1024ULL);
+      opt.tt = tt ? &*tt : nullptr;
+
       std::uint64_t lastNodes = 0;
       double totalSec = 0.0;
 
       for (int k = 0; k < iters; ++k) {
+        if (tt) tt->clear(); // every iteration starts cold
         auto t0 = std::chrono::steady_clock::now();
-        lastNodes = perft(b, depth);
+        lastNodes = perft(b, depth, opt);
         auto t1 = std::chrono::steady_clock::now();
         std::chrono::duration<double> dt = t1 - t0;
         totalSec += dt.count();
@@ -495,13 +701,119 @@ int main(int argc, char** argv) {
 
       std::cout << "bench perft depth " << depth
                 << " iters " << iters
+                << " threads " << opt.threads
                 << " nodes " << lastNodes
                 << " avg_sec " << std::fixed << std::setprecision(6) << avgSec
-                << " nps " << static_cast<std::uint64_t>(nps)
-                << "\n";
+                << " nps " << static_cast<std::uint64_t>(nps);
+      if (reportBackend) std::cout << " backend " << slider_backend_name(slider_backend());
+      std::cout << "\n";
       return 0;
     }
 
+    // bench perftsuite <file.epd> [maxdepth <N>] [hash <MB>] [threads <N>] [split <plies>] [json <path|->]
+    if (sub == "perftsuite") {
+      if (args.size() < 3) { usage(); return 1; }
+      const std::string path = args[2];
+
+      int maxDepth = 99;
+      int hashMb = 0;
+      PerftOptions opt{};
+      std::string jsonPath;
+      for (size_t i = 3; i + 1 < args.size(); i += 2) {
+        const std::string& k = args[i];
+        if      (k == "maxdepth") maxDepth = to_int(args[i + 1]);
+        else if (k == "hash")     hashMb = std::max(0, to_int(args[i + 1]));
+        else if (k == "threads")  opt.threads = std::max(1, to_int(args[i + 1]));
+        else if (k == "split")    opt.split_depth = std::max(0, to_int(args[i + 1]));
+        else if (k == "json")     jsonPath = args[i + 1];
+        else { std::cerr << "error: unknown perftsuite option: " << k << "\n"; return 1; }
+      }
+
+      std::ifstream in(path);
+      if (!in) { std::cerr << "error: cannot open " << path << "\n"; return 2; }
+
+      std::optional<PerftTT> tt;
+      if (hashMb > 0) tt.emplace(static_cast<std::size_t>(hashMb) * 1024ULL * 1024ULL);
+      opt.tt = tt ? &*tt : nullptr;
+
+      // With "json -" stdout carries only the JSON document.
+      std::ostream& log = (jsonPath == "-") ? std::cerr : std::cout;
+
+      struct Run { int pos; std::string fen; int depth; std::uint64_t nodes, expected; double sec; };
+      std::vector<Run> runs;
+      std::uint64_t totalNodes = 0;
+      double totalSec = 0.0;
+      int failed = 0;
+      int positions = 0;
+
+      std::string line;
+      while (std::getline(in, line)) {
+        PerftEpd epd;
+        if (!parse_perft_epd(line, epd)) continue;
+        Board b;
+        try { set_from_fen(b, epd.fen); }
+        catch (const FenError& e) { std::cerr << "error: " << e.what() << ": " << epd.fen << "\n"; return 2; }
+        ++positions;
+
+        for (const auto& [depth, expected] : epd.refs) {
+          if (depth > maxDepth) continue;
+          if (tt) tt->clear(); // time every run from a cold cache
+          auto t0 = std::chrono::steady_clock::now();
+          const std::uint64_t nodes = perft(b, depth, opt);
+          auto t1 = std::chrono::steady_clock::now();
+          const double sec = std::chrono::duration<double>(t1 - t0).count();
+
+          runs.push_back(Run{positions, epd.fen, depth, nodes, expected, sec});
+          totalNodes += nodes;
+          totalSec += sec;
+          if (nodes != expected) ++failed;
+
+          log << "perftsuite pos " << positions << " depth " << depth
+              << " nodes " << nodes << " expected " << expected
+              << (nodes == expected ? " ok" : " FAIL")
+              << " sec " << std::fixed << std::setprecision(6) << sec
+              << " nps " << static_cast<std::uint64_t>(sec > 0.0 ? static_cast<double>(nodes) / sec : 0.0)
+              << "\n";
+        }
+      }
+
+      const double totalNps = totalSec > 0.0 ? static_cast<double>(totalNodes) / totalSec : 0.0;
+      log << "perftsuite positions " << positions << " runs " << runs.size() << " failed " << failed
+          << " nodes " << totalNodes
+          << " sec " << std::fixed << std::setprecision(6) << totalSec
+          << " nps " << static_cast<std::uint64_t>(totalNps) << "\n";
+
+      if (!jsonPath.empty()) {
+        std::ofstream jf;
+        if (jsonPath != "-") {
+          jf.open(jsonPath);
+          if (!jf) { std::cerr << "error: cannot write " << jsonPath << "\n"; return 2; }
+        }
+        std::ostream& js = (jsonPath == "-") ? std::cout : jf;
+        js << std::fixed << std::setprecision(6);
+        js << "{\n  \"suite\": " << json_str(path)
+           << ",\n  \"threads\": " << opt.threads
+           << ",\n  \"hash_mb\": " << hashMb
+           << ",\n  \"runs\": [\n";
+        for (size_t k = 0; k < runs.size(); ++k) {
+          const Run& r = runs[k];
+          js << "    {\"pos\": " << r.pos << ", \"fen\": " << json_str(r.fen)
+             << ", \"depth\": " << r.depth << ", \"nodes\": " << r.nodes
+             << ", \"expected\": " << r.expected
+             << ", \"ok\": " << (r.nodes == r.expected ? "true" : "false")
+             << ", \"sec\": " << r.sec
+             << ", \"nps\": " << static_cast<std::uint64_t>(r.sec > 0.0 ? static_cast<double>(r.nodes) / r.sec : 0.0)
+             << "}" << (k + 1 < runs.size() ? "," : "") << "\n";
+        }
+        js << "  ],\n  \"total\": {\"positions\": " << positions << ", \"runs\": " << runs.size()
+           << ", \"failed\": " << failed << ", \"nodes\": " << totalNodes
+           << ", \"sec\": " << totalSec << ", \"nps\": " << static_cast<std::uint64_t>(totalNps) << "}\n}\n";
+      }
+
+      // Non-zero exit on any mismatch so scripts can gate on it
+      return failed ? 3 : 0;
+    }
+
     if (sub == "search") {
       ParsedSearchArgs p = parse_search_like(args, 2);
 
@@ -519,6 +831,7 @@ int main(int argc, char** argv) {
       Board b = board_from_args(args, p.fenStart);
 
       std::uint64_t lastNodes = 0;
+      int lastHashfull = 0;
       int lastScore = 0;
       Move lastBest{};
       std::vector<Move> lastPv;
@@ -534,6 +847,7 @@ int main(int argc, char** argv) {
         totalSec += dt.count();
 
         lastNodes = r.nodes;
+        lastHashfull = r.hashfull;
         lastScore = r.score;
         lastBest = r.best;
         lastPv = r.pv;
@@ -548,6 +862,7 @@ int main(int argc, char** argv) {
                 << " nodes " << lastNodes
                 << " avg_sec " << std::fixed << std::setprecision(6) << avgSec
                 << " nps " << static_cast<std::uint64_t>(nps)
+                << " hashfull " << lastHashfull
                 << " pv ";
       for (auto& m : lastPv) std::cout << move_to_uci(m) << ' ';
       std::cout << "\n";
@@ -1,366 +1,433 @@
 #include "euclid/movegen.hpp"
 
-#include "euclid/attack.hpp" // square_attacked, in_check
+#include "euclid/attack.hpp" // square_attacked
+#include "euclid/attacks_tbl.hpp"
+#include "euclid/bitboard.hpp"
+#include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 
 namespace euclid {
 namespace {
 
-static inline Color other(Color c){ return c==Color::White?Color::Black:Color::White; }
+static constexpr Color other(Color c){ return c==Color::White?Color::Black:Color::White; }
+
+// Which subset of moves to emit. Captures = captures, en passant and every
+// promotion (quiet ones included); Quiets = the rest, castling included.
+// Evasions = every legal reply to a check (requires the side to move in check).
+enum class GenType { All, Captures, Quiets, Evasions };
+
+// Restrictions shared by every piece generator (the side to move is a template
+// parameter of the generators, so directions and back ranks are compile-time).
+// Pseudo-legal: targets = not own / not enemy king, no pins.
+// Legal: targets additionally limited to the check-evasion mask, pinned pieces to their pin line.
+struct GenCtx {
+  Square ks;       // our king (-1 if absent)
+  U64    occ;
+  U64    enemy;
+  U64    evasion;  // allowed destinations for non-king moves (check evasion, own pieces removed)
+  U64    targets;  // evasion further limited by GenType (enemy squares / empty squares)
+  U64    pinned;   // 0 in pseudo-legal mode
+  bool   legal;
+};
+
+static inline bool pin_ok(const GenCtx& g, Square from, Square to) {
+  if (!(g.pinned & square_bb(from))) return true;
+  return (ATT().line[static_cast<std::size_t>(g.ks)][static_cast<std::size_t>(from)] & square_bb(to)) != 0ULL;
+}
 
-static inline bool kings_adjacent(Square a, Square b) {
-  int fa = file_of(a), ra = rank_of(a);
-  int fb = file_of(b), rb = rank_of(b);
-  return std::abs(fa - fb) <= 1 && std::abs(ra - rb) <= 1;
+// En passant removes two pawns from the board at once: check for discovered attacks on our king.
+template <Color Us>
+static bool ep_is_legal(const Board& b, Square from, Square to) {
+  constexpr Color Them = other(Us);
+  const Square ks = b.king_square(Us);
+  if (ks < 0) return true;
+
+  const Square cap = to + (Us == Color::White ? -8 : +8);
+  const U64 occ = (b.occupancy() ^ square_bb(from) ^ square_bb(cap)) | square_bb(to);
+  const auto& T = ATT();
+  const std::size_t ki = static_cast<std::size_t>(ks);
+
+  if (T.knight_att[ki] & b.pieces(Them, Piece::Knight)) return false;
+  if (T.pawn_att[static_cast<std::size_t>(Us)][ki] & b.pieces(Them, Piece::Pawn) & ~square_bb(cap)) return false;
+  const U64 queens = b.pieces(Them, Piece::Queen);
+  if (bishop_attacks(ks, occ) & (b.pieces(Them, Piece::Bishop) | queens)) return false;
+  if (rook_attacks(ks, occ)   & (b.pieces(Them, Piece::Rook)   | queens)) return false;
+  return true;
 }
 
-static inline Square find_king(const Board& b, Color c) {
-  for (int s = 0; s < 64; ++s) {
-    Color cc;
-    Piece p = b.piece_at(s, &cc);
-    if (p == Piece::King && cc == c) return s;
-  }
-  return -1;
+constexpr U64 FILE_A_BB = 0x0101010101010101ULL;
+constexpr U64 FILE_H_BB = FILE_A_BB << 7;
+constexpr U64 RANK_1_BB = 0x00000000000000FFULL;
+constexpr U64 RANK_3_BB = RANK_1_BB << 16;
+constexpr U64 RANK_6_BB = RANK_1_BB << 40;
+constexpr U64 RANK_8_BB = RANK_1_BB << 56;
+
+// Shift a set of squares by 'delta' (positive = towards rank 8).
+static constexpr U64 shift_bb(U64 bb, int delta) {
+  return delta > 0 ? (bb << delta) : (bb >> -delta);
+}
+
+// Non-pawn move: the captured piece type comes straight from the mailbox.
+static inline void push_piece_move(const Board& b, const GenCtx& g, MoveList& out, Square from, Square to) {
+  if (g.enemy & square_bb(to)) out.push(Move(from, to, MoveFlag::Capture), b.piece_at(to));
+  else                         out.push(Move(from, to, MoveFlag::Quiet));
+}
+
+// All four promotion pieces, queen first.
+static inline void push_promotions(MoveList& out, Square from, Square to, Piece cap) {
+  const bool isCap = (cap != Piece::None);
+  out.push(make_promotion(from, to, Piece::Queen,  isCap), cap);
+  out.push(make_promotion(from, to, Piece::Rook,   isCap), cap);
+  out.push(make_promotion(from, to, Piece::Bishop, isCap), cap);
+  out.push(make_promotion(from, to, Piece::Knight, isCap), cap);
 }
 
-static inline void push_promo_or_quiet(MoveList& out, Square from, Square to, MoveFlag fl) {
-  // For now, only queen promotions are generated (sufficient for early engine phases).
-  int r = rank_of(to);
-  if (r == 0 || r == 7) {
-    Move m{};
-    m.from = from; m.to = to; m.flags = fl; m.promo = Piece::Queen;
-    out.push(m);
-  } else {
-    Move m{};
-    m.from = from; m.to = to; m.flags = fl; m.promo = Piece::None;
-    out.push(m);
+// Serialize a destination set produced by shifting the pawn set by 'delta'.
+static inline void push_pawn_targets(const Board& b, const GenCtx& g, MoveList& out,
+                                     U64 tos, int delta, bool capture) {
+  while (tos) {
+    const Square to = pop_lsb(tos);
+    const Square from = to - delta;
+    if (!pin_ok(g, from, to)) continue;
+
+    const Piece cap = capture ? b.piece_at(to) : Piece::None;
+    if (square_bb(to) & (RANK_1_BB | RANK_8_BB)) push_promotions(out, from, to, cap);
+    else out.push(Move(from, to, capture ? MoveFlag::Capture : MoveFlag::Quiet), cap);
   }
 }
 
-// ---- Pawn move generation (includes EP target square; legality checked by caller) ----
-static void gen_pawn_moves(const Board& b, MoveList& out) {
-  const Color us  = b.side_to_move();
-  const Color opp = other(us);
-  const int ep = b.ep_square();
+// ---- Pawn move generation: set-wise shifts of the whole pawn bitboard ----
+template <Color Us, GenType Type>
+static void gen_pawn_moves(const Board& b, const GenCtx& g, MoveList& out) {
+  constexpr Color Them  = other(Us);
+  constexpr bool white  = (Us == Color::White);
+  constexpr int up      = white ? 8 : -8;
+  constexpr int upLeft  = white ? 7 : -9;  // towards the a-file
+  constexpr int upRight = white ? 9 : -7;  // towards the h-file
+  constexpr U64 rank3   = white ? RANK_3_BB : RANK_6_BB;
+  constexpr U64 promo   = white ? RANK_8_BB : RANK_1_BB;
+
+  const U64 pawns = b.pieces(Us, Piece::Pawn);
+  const U64 empty = ~g.occ;
+
+  // Pushes (a double push needs the single-push square empty too)
+  const U64 single = shift_bb(pawns, up) & empty;
+  if constexpr (Type != GenType::Captures) {
+    U64 dbl = shift_bb(single & rank3, up) & empty & g.evasion;
+    push_pawn_targets(b, g, out, single & ~promo & g.evasion, up, /*capture=*/false);
+    while (dbl) {
+      const Square to = pop_lsb(dbl);
+      const Square from = to - 2 * up;
+      if (pin_ok(g, from, to)) out.push(Move(from, to, MoveFlag::DoublePush));
+    }
+  }
+  if constexpr (Type == GenType::Quiets) return;
 
-  for (int s = 0; s < 64; ++s) {
-    Color pc;
-    Piece p = b.piece_at(s, &pc);
-    if (p != Piece::Pawn || pc != us) continue;
-
-    const int f0 = file_of(s);
-    const int r0 = rank_of(s);
-
-    if (us == Color::White) {
-      // forward 1
-      const int fwd = s + 8;
-      if (fwd < 64) {
-        Color oc; Piece occ = b.piece_at(fwd, &oc);
-        if (occ == Piece::None) {
-          push_promo_or_quiet(out, s, fwd, MoveFlag::Quiet);
-
-          // forward 2 from rank 2 (r0 == 1), if both empty
-          if (r0 == 1) {
-            const int fwd2 = s + 16;
-            if (fwd2 < 64) {
-              Color oc2; Piece occ2 = b.piece_at(fwd2, &oc2);
-              if (occ2 == Piece::None) {
-                Move m{}; m.from = s; m.to = fwd2; m.flags = MoveFlag::Quiet; m.promo = Piece::None;
-                out.push(m);
-              }
-            }
-          }
-        }
-      }
-
-      // captures
-      if (f0 > 0) {
-        const int cap = s + 7;
-        if (cap < 64) {
-          Color oc; Piece tp = b.piece_at(cap, &oc);
-          if (tp != Piece::None && oc == opp && tp != Piece::King) {
-            push_promo_or_quiet(out, s, cap, MoveFlag::Capture);
-          }
-        }
-      }
-      if (f0 < 7) {
-        const int cap = s + 9;
-        if (cap < 64) {
-          Color oc; Piece tp = b.piece_at(cap, &oc);
-          if (tp != Piece::None && oc == opp && tp != Piece::King) {
-            push_promo_or_quiet(out, s, cap, MoveFlag::Capture);
-          }
-        }
-      }
-
-      // en passant (destination is ep square; captured pawn handled in do_move via ep_square)
-      if (ep >= 0) {
-        if (f0 > 0 && (s + 7) == ep) {
-          Move m{}; m.from = s; m.to = ep; m.flags = MoveFlag::EnPassant; m.promo = Piece::None;
-          out.push(m);
-        }
-        if (f0 < 7 && (s + 9) == ep) {
-          Move m{}; m.from = s; m.to = ep; m.flags = MoveFlag::EnPassant; m.promo = Piece::None;
-          out.push(m);
-        }
-      }
-    } else {
-      // Black pawns
-      const int fwd = s - 8;
-      if (fwd >= 0) {
-        Color oc; Piece occ = b.piece_at(fwd, &oc);
-        if (occ == Piece::None) {
-          push_promo_or_quiet(out, s, fwd, MoveFlag::Quiet);
-
-          if (r0 == 6) {
-            const int fwd2 = s - 16;
-            if (fwd2 >= 0) {
-              Color oc2; Piece occ2 = b.piece_at(fwd2, &oc2);
-              if (occ2 == Piece::None) {
-                Move m{}; m.from = s; m.to = fwd2; m.flags = MoveFlag::Quiet; m.promo = Piece::None;
-                out.push(m);
-              }
-            }
-          }
-        }
-      }
-
-      // captures
-      if (f0 > 0) {
-        const int cap = s - 9;
-        if (cap >= 0) {
-          Color oc; Piece tp = b.piece_at(cap, &oc);
-          if (tp != Piece::None && oc == opp && tp != Piece::King) {
-            push_promo_or_quiet(out, s, cap, MoveFlag::Capture);
-          }
-        }
-      }
-      if (f0 < 7) {
-        const int cap = s - 7;
-        if (cap >= 0) {
-          Color oc; Piece tp = b.piece_at(cap, &oc);
-          if (tp != Piece::None && oc == opp && tp != Piece::King) {
-            push_promo_or_quiet(out, s, cap, MoveFlag::Capture);
-          }
-        }
-      }
-
-      // en passant
-      if (ep >= 0) {
-        if (f0 > 0 && (s - 9) == ep) {
-          Move m{}; m.from = s; m.to = ep; m.flags = MoveFlag::EnPassant; m.promo = Piece::None;
-          out.push(m);
-        }
-        if (f0 < 7 && (s - 7) == ep) {
-          Move m{}; m.from = s; m.to = ep; m.flags = MoveFlag::EnPassant; m.promo = Piece::None;
-          out.push(m);
-        }
-      }
+  // Push promotions count as tactical moves
+  push_pawn_targets(b, g, out, single & promo & g.evasion, up, /*capture=*/false);
+
+  // Captures (g.evasion already excludes the enemy king)
+  const U64 victims = g.enemy & g.evasion;
+  push_pawn_targets(b, g, out, shift_bb(pawns & ~FILE_A_BB, upLeft)  & victims, upLeft,  /*capture=*/true);
+  push_pawn_targets(b, g, out, shift_bb(pawns & ~FILE_H_BB, upRight) & victims, upRight, /*capture=*/true);
+
+  // En passant (destination is the ep square; captured pawn handled in do_move via ep_square)
+  const int ep = b.ep_square();
+  if (ep >= 0) {
+    U64 froms = pawns & ATT().pawn_att[static_cast<std::size_t>(Them)][static_cast<std::size_t>(ep)];
+    while (froms) {
+      const Square from = pop_lsb(froms);
+      if (!g.legal || ep_is_legal<Us>(b, from, ep)) out.push(Move(from, ep, MoveFlag::EnPassant), Piece::Pawn);
     }
   }
 }
 
-// ---- Knight moves ----
-static void gen_knight_moves(const Board& b, MoveList& out) {
-  const Color us  = b.side_to_move();
-  const Color opp = other(us);
-
-  static const int d[8] = { 17, 15, 10, 6, -17, -15, -10, -6 };
-
-  for (int s = 0; s < 64; ++s) {
-    Color pc;
-    Piece p = b.piece_at(s, &pc);
-    if (p != Piece::Knight || pc != us) continue;
-
-    const int f0 = file_of(s);
-    const int r0 = rank_of(s);
-
-    for (int k = 0; k < 8; ++k) {
-      int t = s + d[k];
-      if (t < 0 || t >= 64) continue;
-      const int f1 = file_of(t);
-      const int r1 = rank_of(t);
-
-      // Ensure valid L-shape without wrap
-      if (std::abs(f1 - f0) + std::abs(r1 - r0) != 3) continue;
-
-      Color oc;
-      Piece op = b.piece_at(t, &oc);
-      if (op == Piece::None || oc != us) {
-        if (op == Piece::King) continue;
-        Move m{};
-        m.from = s; m.to = t;
-        m.flags = (op == Piece::None ? MoveFlag::Quiet : MoveFlag::Capture);
-        m.promo = Piece::None;
-        out.push(m);
-      }
+// ---- Knight moves (a pinned knight can never move) ----
+template <Color Us>
+static void gen_knight_moves(const Board& b, const GenCtx& g, MoveList& out) {
+  const auto& T = ATT();
+
+  U64 froms = b.pieces(Us, Piece::Knight) & ~g.pinned;
+  while (froms) {
+    const Square s = pop_lsb(froms);
+    U64 att = T.knight_att[static_cast<std::size_t>(s)] & g.targets;
+    while (att) {
+      const Square t = pop_lsb(att);
+      push_piece_move(b, g, out, s, t);
     }
   }
 }
 
-// ---- Sliding pieces (bishop/rook/queen) ----
-static void gen_slider(const Board& b, MoveList& out, Piece which) {
-  const Color us  = b.side_to_move();
-  const Color opp = other(us);
-
-  const int dirsB[4] = { 9, 7, -9, -7 };
-  const int dirsR[4] = { 8, -8, 1, -1 };
-
-  const int* dirs = nullptr;
-  int nd = 0;
-
-  if (which == Piece::Bishop) { dirs = dirsB; nd = 4; }
-  if (which == Piece::Rook)   { dirs = dirsR; nd = 4; }
-
-  for (int s = 0; s < 64; ++s) {
-    Color pc;
-    Piece p = b.piece_at(s, &pc);
-    if (pc != us) continue;
-    if (which == Piece::Bishop && p != Piece::Bishop) continue;
-    if (which == Piece::Rook   && p != Piece::Rook)   continue;
-    if (which == Piece::Queen  && p != Piece::Queen)  continue;
-
-    auto emit_ray = [&](int step) {
-      int t = s;
-      int f0 = file_of(s);
-
-      for (;;) {
-        int nxt = t + step;
-        if (nxt < 0 || nxt >= 64) break;
-
-        // file wrap check for horizontal/diagonal
-        int f1 = file_of(nxt);
-        if (std::abs(f1 - file_of(t)) > 1 && (step == 1 || step == -1 || step == 9 || step == -9 || step == 7 || step == -7))
-          break;
-        if ((step == 1 || step == -1) && std::abs(f1 - f0) != std::abs(nxt - s) % 8) {
-          // conservative; the earlier wrap guard is usually enough
-        }
-
-        t = nxt;
-
-        Color oc;
-        Piece op = b.piece_at(t, &oc);
-
-        if (op != Piece::None && oc == us) break;
-        if (op == Piece::King) break;
-
-        Move m{};
-        m.from = s; m.to = t;
-        m.flags = (op == Piece::None ? MoveFlag::Quiet : MoveFlag::Capture);
-        m.promo = Piece::None;
-        out.push(m);
-
-        if (op != Piece::None) break; // capture stops ray
-      }
-    };
-
-    if (which == Piece::Queen) {
-      // queen = bishop + rook
-      for (int i = 0; i < 4; ++i) emit_ray(dirsB[i]);
-      for (int i = 0; i < 4; ++i) emit_ray(dirsR[i]);
-    } else {
-      for (int i = 0; i < nd; ++i) emit_ray(dirs[i]);
+// ---- Sliding pieces (bishop/rook/queen) via magic lookups ----
+template <Color Us, Piece Which>
+static void gen_slider(const Board& b, const GenCtx& g, MoveList& out) {
+  const auto& T = ATT();
+
+  U64 froms = b.pieces(Us, Which);
+  while (froms) {
+    const Square s = pop_lsb(froms);
+
+    U64 att = 0;
+    if constexpr (Which == Piece::Bishop)      att = bishop_attacks(s, g.occ);
+    else if constexpr (Which == Piece::Rook)   att = rook_attacks(s, g.occ);
+    else                                       att = queen_attacks(s, g.occ);
+    att &= g.targets;
+    if (g.pinned & square_bb(s)) {
+      att &= T.line[static_cast<std::size_t>(g.ks)][static_cast<std::size_t>(s)];
+    }
+
+    while (att) {
+      const Square t = pop_lsb(att);
+      push_piece_move(b, g, out, s, t);
     }
   }
 }
 
-// ---- King moves (adjacency restriction is correct here) ----
-static void gen_king_moves(const Board& b, MoveList& out) {
-  const Color us  = b.side_to_move();
-  const Color opp = other(us);
+// ---- King moves (never into check; the king is lifted off the board in legal mode) ----
+template <Color Us, GenType Type>
+static void gen_king_moves(const Board& b, const GenCtx& g, MoveList& out) {
+  constexpr Color Them = other(Us);
+  const Square ks = g.ks;
+  if (ks < 0) return;
+
+  const U64 occ = g.legal ? (g.occ ^ square_bb(ks)) : g.occ;
+  U64 att = ATT().king_att[static_cast<std::size_t>(ks)]
+          & ~b.occupancy(Us) & ~b.pieces(Them, Piece::King);
+  if constexpr (Type == GenType::Captures) att &= g.enemy;
+  if constexpr (Type == GenType::Quiets)   att &= ~g.occ;
+  if constexpr (Type == GenType::Evasions) {
+    // Stepping back along a checking slider's line stays in check: drop those
+    // squares before paying for the attack test.
+    U64 sliders = b.checkers() & ~b.pieces(Them, Piece::Knight) & ~b.pieces(Them, Piece::Pawn);
+    while (sliders) {
+      const Square c = pop_lsb(sliders);
+      att &= ~(ATT().line[static_cast<std::size_t>(ks)][static_cast<std::size_t>(c)] ^ square_bb(c));
+    }
+  }
+  while (att) {
+    const Square t = pop_lsb(att);
+    if (square_attacked<Them>(b, t, occ)) continue;
 
-  Square ks = find_king(b, us);
-  Square ok = find_king(b, opp);
+    push_piece_move(b, g, out, ks, t);
+  }
 
-  static const int d[8] = { 8, -8, 1, -1, 9, -9, 7, -7 };
+  // Castling: rook on its corner, empty squares between, not in check,
+  // and the squares the king passes through not attacked.
+  if constexpr (Type == GenType::Captures || Type == GenType::Evasions) return;
+  if (b.checkers()) return;
+  const Castling cr = b.castling();
+  constexpr unsigned kRight = (Us == Color::White) ? 0x1u : 0x4u;
+  constexpr unsigned qRight = (Us == Color::White) ? 0x2u : 0x8u;
+  constexpr Square base = (Us == Color::White) ? 0 : 56;
+  if (ks != base + 4) return;
+
+  const U64 rooks = b.pieces(Us, Piece::Rook);
+  // O-O: e->g, f/g empty and not attacked
+  if ((cr.rights & kRight) && (rooks & square_bb(base + 7)) &&
+      !(g.occ & (square_bb(base + 5) | square_bb(base + 6))) &&
+      !square_attacked<Them>(b, base + 5) &&
+      !square_attacked<Them>(b, base + 6)) {
+    out.push(Move(base + 4, base + 6, MoveFlag::Castle));
+  }
+  // O-O-O: e->c, d/c/b empty, d/c not attacked
+  if ((cr.rights & qRight) && (rooks & square_bb(base)) &&
+      !(g.occ & (square_bb(base + 1) | square_bb(base + 2) | square_bb(base + 3))) &&
+      !square_attacked<Them>(b, base + 3) &&
+      !square_attacked<Them>(b, base + 2)) {
+    out.push(Move(base + 4, base + 2, MoveFlag::Castle));
+  }
+}
+
+template <Color Us, GenType Type>
+static GenCtx make_ctx(const Board& b, bool legal) {
+  constexpr Color Them = other(Us);
+  GenCtx g{};
+  g.ks    = b.king_square(Us);
+  g.occ   = b.occupancy();
+  g.enemy = b.occupancy(Them);
+  g.evasion = ~b.occupancy(Us) & ~b.pieces(Them, Piece::King); // never "capture" a king
+  g.pinned  = 0ULL;
+  g.legal   = legal;
+
+  if (legal && g.ks >= 0) {
+    g.pinned = b.pinned();
+    const U64 chk = b.checkers();
+    if (chk) {
+      // Double check: only the king may move. Single check: capture the checker or block.
+      if (chk & (chk - 1ULL)) g.evasion = 0ULL;
+      else g.evasion &= chk | ATT().between[static_cast<std::size_t>(g.ks)][static_cast<std::size_t>(lsb(chk))];
+    }
+  }
 
-  for (int k = 0; k < 8; ++k) {
-    int t = ks + d[k];
-    if (t < 0 || t >= 64) continue;
+  g.targets = g.evasion;
+  if constexpr (Type == GenType::Captures) g.targets &= g.enemy;
+  if constexpr (Type == GenType::Quiets)   g.targets &= ~g.occ;
+  return g;
+}
 
-    // avoid wrap for horizontal/diag
-    if (std::abs(file_of(t) - file_of(ks)) > 1) continue;
+template <Color Us, GenType Type>
+static void generate(const Board& b, MoveList& out, bool legal) {
+  out.sz = 0;
+  const GenCtx g = make_ctx<Us, Type>(b, legal);
+  if (g.evasion) {
+    gen_pawn_moves<Us, Type>(b, g, out);
+    gen_knight_moves<Us>(b, g, out);
+    gen_slider<Us, Piece::Bishop>(b, g, out);
+    gen_slider<Us, Piece::Rook>(b, g, out);
+    gen_slider<Us, Piece::Queen>(b, g, out);
+  }
+  gen_king_moves<Us, Type>(b, g, out);
+}
 
-    Color oc;
-    Piece op = b.piece_at(t, &oc);
-    if (op != Piece::None && oc == us) continue;
-    if (op == Piece::King) continue;
+template <Color Us>
+static bool is_legal_impl(const Board& b, const Move& m) {
+  constexpr Color Them = other(Us);
+  const Square ks = b.king_square(Us);
+  if (ks < 0) return true; // fail-safe for odd test setups
+
+  const Square from = m.from();
+  const Square to   = m.to();
+
+  if (m.flags() == MoveFlag::Castle) {
+    if (b.checkers()) return false;
+    const int step = (to > from) ? 1 : -1;
+    for (Square s = from + step; ; s += step) {
+      if (square_attacked<Them>(b, s)) return false;
+      if (s == to) break;
+    }
+    return true;
+  }
 
-    // King cannot move adjacent to enemy king
-    if (kings_adjacent(t, ok)) continue;
+  if (from == ks) {
+    return !square_attacked<Them>(b, to, b.occupancy() ^ square_bb(ks));
+  }
 
-    // King cannot move into check
-    if (square_attacked(b, t, opp)) continue;
+  if (m.flags() == MoveFlag::EnPassant) {
+    return ep_is_legal<Us>(b, from, to);
+  }
 
-    Move m{};
-    m.from = ks; m.to = t;
-    m.flags = (op == Piece::None ? MoveFlag::Quiet : MoveFlag::Capture);
-    m.promo = Piece::None;
-    out.push(m);
+  const U64 chk = b.checkers();
+  if (chk) {
+    if (chk & (chk - 1ULL)) return false;
+    const U64 evasion = chk | ATT().between[static_cast<std::size_t>(ks)][static_cast<std::size_t>(lsb(chk))];
+    if (!(evasion & square_bb(to))) return false;
   }
 
-  // Castling (basic: empty squares, not in check, and squares passed through not attacked)
-  Castling cr = b.castling();
-  if (us == Color::White) {
-    // White O-O: e1->g1, squares f1,g1 empty, not in check, f1/g1 not attacked
-    if (cr.rights & 0x1u) {
-      if (b.piece_at(5) == Piece::None && b.piece_at(6) == Piece::None) {
-        if (!in_check(b, us) &&
-            !square_attacked(b, 5, opp) &&
-            !square_attacked(b, 6, opp)) {
-          Move m{}; m.from = 4; m.to = 6; m.flags = MoveFlag::Castle; m.promo = Piece::None;
-          out.push(m);
-        }
-      }
-    }
-    // White O-O-O: e1->c1, squares d1,c1,b1 empty, not in check, d1/c1 not attacked
-    if (cr.rights & 0x2u) {
-      if (b.piece_at(3) == Piece::None && b.piece_at(2) == Piece::None && b.piece_at(1) == Piece::None) {
-        if (!in_check(b, us) &&
-            !square_attacked(b, 3, opp) &&
-            !square_attacked(b, 2, opp)) {
-          Move m{}; m.from = 4; m.to = 2; m.flags = MoveFlag::Castle; m.promo = Piece::None;
-          out.push(m);
-        }
-      }
+  if (!(b.pinned() & square_bb(from))) return true;
+  return (ATT().line[static_cast<std::size_t>(ks)][static_cast<std::size_t>(from)] & square_bb(to)) != 0ULL;
+}
+
+// Would the pseudo-legal generator produce exactly m (flags included)?
+template <Color Us>
+static bool is_pseudo_legal_impl(const Board& b, const Move& m) {
+  constexpr Color Them  = other(Us);
+  constexpr bool white  = (Us == Color::White);
+  constexpr int up      = white ? 8 : -8;
+  constexpr U64 promo   = white ? RANK_8_BB : RANK_1_BB;
+  constexpr U64 rank2   = white ? (RANK_1_BB << 8) : (RANK_1_BB << 48);
+  constexpr Square base = white ? 0 : 56;
+
+  if (m.is_null()) return false;
+  const Square from = m.from();
+  const Square to   = m.to();
+  const U64 toBB    = square_bb(to);
+
+  Color pcColor{};
+  const Piece pc = b.piece_at(from, &pcColor);
+  if (pc == Piece::None || pcColor != Us) return false;
+  if (b.occupancy(Us) & toBB) return false;
+  if (b.pieces(Them, Piece::King) & toBB) return false;
+
+  const U64 occ   = b.occupancy();
+  const bool isEnemy = (b.occupancy(Them) & toBB) != 0ULL;
+  const auto& T = ATT();
+  const std::size_t fi = static_cast<std::size_t>(from);
+
+  const MoveFlag flag = m.flags();
+  if (flag == MoveFlag::Castle) {
+    if (pc != Piece::King || from != base + 4) return false;
+    const Castling cr = b.castling();
+    const U64 rooks = b.pieces(Us, Piece::Rook);
+    if (to == base + 6) {
+      return (cr.rights & (white ? 0x1u : 0x4u)) && (rooks & square_bb(base + 7)) &&
+             !(occ & (square_bb(base + 5) | square_bb(base + 6)));
     }
-  } else {
-    // Black O-O: e8->g8
-    if (cr.rights & 0x4u) {
-      if (b.piece_at(61) == Piece::None && b.piece_at(62) == Piece::None) {
-        if (!in_check(b, us) &&
-            !square_attacked(b, 61, opp) &&
-            !square_attacked(b, 62, opp)) {
-          Move m{}; m.from = 60; m.to = 62; m.flags = MoveFlag::Castle; m.promo = Piece::None;
-          out.push(m);
-        }
-      }
+    if (to == base + 2) {
+      return (cr.rights & (white ? 0x2u : 0x8u)) && (rooks & square_bb(base)) &&
+             !(occ & (square_bb(base + 1) | square_bb(base + 2) | square_bb(base + 3)));
     }
-    // Black O-O-O: e8->c8
-    if (cr.rights & 0x8u) {
-      if (b.piece_at(59) == Piece::None && b.piece_at(58) == Piece::None && b.piece_at(57) == Piece::None) {
-        if (!in_check(b, us) &&
-            !square_attacked(b, 59, opp) &&
-            !square_attacked(b, 58, opp)) {
-          Move m{}; m.from = 60; m.to = 58; m.flags = MoveFlag::Castle; m.promo = Piece::None;
-          out.push(m);
-        }
-      }
+    return false;
+  }
+
+  if (pc == Piece::Pawn) {
+    const bool onPromo = (toBB & promo) != 0ULL;
+    const bool pawnCap = (T.pawn_att[static_cast<std::size_t>(Us)][fi] & toBB) != 0ULL;
+    switch (flag) {
+    case MoveFlag::Quiet:      return !onPromo && to == from + up && !(occ & toBB);
+    case MoveFlag::DoublePush: return (square_bb(from) & rank2) && to == from + 2 * up &&
+                                      !(occ & (square_bb(from + up) | toBB));
+    case MoveFlag::Capture:    return !onPromo && pawnCap && isEnemy;
+    case MoveFlag::EnPassant:  return pawnCap && to == b.ep_square() && !(occ & toBB);
+    default:  // promotions; flags 3, 6 and 7 are unused
+      if (!m.is_promotion() || !onPromo) return false;
+      return m.is_capture() ? (pawnCap && isEnemy) : (to == from + up && !(occ & toBB));
     }
   }
+
+  // Pieces: only plain quiet moves and captures, onto a square they attack.
+  if (flag == MoveFlag::Quiet) { if (isEnemy) return false; }
+  else if (flag == MoveFlag::Capture) { if (!isEnemy) return false; }
+  else return false;
+
+  U64 att = 0;
+  switch (pc) {
+  case Piece::Knight: att = T.knight_att[fi]; break;
+  case Piece::Bishop: att = bishop_attacks(from, occ); break;
+  case Piece::Rook:   att = rook_attacks(from, occ); break;
+  case Piece::Queen:  att = queen_attacks(from, occ); break;
+  case Piece::King:   att = T.king_att[fi]; break;
+  default: break;
+  }
+  return (att & toBB) != 0ULL;
 }
 
 } // namespace
 
+// Public entry points dispatch on the side to move once per call.
 void generate_pseudo_legal(const Board& b, MoveList& out) {
-  out.sz = 0;
-  gen_pawn_moves(b, out);
-  gen_knight_moves(b, out);
-  gen_slider(b, out, Piece::Bishop);
-  gen_slider(b, out, Piece::Rook);
-  gen_slider(b, out, Piece::Queen);
-  gen_king_moves(b, out);
+  if (b.side_to_move() == Color::White) generate<Color::White, GenType::All>(b, out, /*legal=*/false);
+  else                                  generate<Color::Black, GenType::All>(b, out, /*legal=*/false);
+}
+
+void generate_legal(const Board& b, MoveList& out) {
+  if (b.side_to_move() == Color::White) generate<Color::White, GenType::All>(b, out, /*legal=*/true);
+  else                                  generate<Color::Black, GenType::All>(b, out, /*legal=*/true);
+}
+
+void generate_captures(const Board& b, MoveList& out) {
+  if (b.side_to_move() == Color::White) generate<Color::White, GenType::Captures>(b, out, /*legal=*/true);
+  else                                  generate<Color::Black, GenType::Captures>(b, out, /*legal=*/true);
+}
+
+void generate_quiets(const Board& b, MoveList& out) {
+  if (b.side_to_move() == Color::White) generate<Color::White, GenType::Quiets>(b, out, /*legal=*/true);
+  else                                  generate<Color::Black, GenType::Quiets>(b, out, /*legal=*/true);
+}
+
+void generate_evasions(const Board& b, MoveList& out) {
+  if (!b.checkers()) { generate_legal(b, out); return; }
+  if (b.side_to_move() == Color::White) generate<Color::White, GenType::Evasions>(b, out, /*legal=*/true);
+  else                                  generate<Color::Black, GenType::Evasions>(b, out, /*legal=*/true);
+}
+
+bool is_pseudo_legal(const Board& b, const Move& m) {
+  return b.side_to_move() == Color::White ? is_pseudo_legal_impl<Color::White>(b, m)
+                                          : is_pseudo_legal_impl<Color::Black>(b, m);
+}
+
+bool is_legal(const Board& b, const Move& m) {
+  return b.side_to_move() == Color::White ? is_legal_impl<Color::White>(b, m)
+                                          : is_legal_impl<Color::Black>(b, m);
 }
 
 } // namespace euclid
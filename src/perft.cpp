@@ -1,56 +1,218 @@
 #include "euclid/perft.hpp"
 #include "euclid/movegen.hpp"
-#include "euclid/attack.hpp"
 #include "euclid/move_do.hpp"
+#include <algorithm>
+#include <sstream>
+#include <thread>
 #include <vector>
 
 namespace euclid {
 
-static std::uint64_t perft_mut(Board& b, int depth) {
-  if (depth == 0) return 1ULL;
+PerftTT::PerftTT(std::size_t bytes) {
+  // Largest power of two that fits in 'bytes' (at least one entry)
+  std::size_t n = 1;
+  while (n * 2 * sizeof(Entry) <= bytes) n *= 2;
+  entries_ = std::vector<Entry>(n);
+  mask_ = n - 1;
+}
 
-  MoveList ml;
-  generate_pseudo_legal(b, ml);
+void PerftTT::clear() {
+  for (auto& e : entries_) {
+    e.check.store(0, std::memory_order_relaxed);
+    e.data.store(0, std::memory_order_relaxed);
+  }
+}
+
+bool PerftTT::probe(U64 key, int depth, std::uint64_t& nodes) const {
+  const Entry& e = entries_[static_cast<std::size_t>(key) & mask_];
+  const std::uint64_t data = e.data.load(std::memory_order_relaxed);
+  const U64 check = e.check.load(std::memory_order_relaxed);
+  if ((check ^ data) != key || (data & 0xFFu) != static_cast<std::uint64_t>(depth)) return false;
+  nodes = data >> 8;
+  return true;
+}
+
+void PerftTT::store(U64 key, int depth, std::uint64_t nodes) {
+  Entry& e = entries_[static_cast<std::size_t>(key) & mask_];
+  const std::uint64_t data = (nodes << 8) | static_cast<std::uint64_t>(depth & 0xFF);
+  e.check.store(key ^ data, std::memory_order_relaxed);
+  e.data.store(data, std::memory_order_relaxed);
+}
+
+static std::uint64_t perft_mut(Board& b, int depth, PerftTT* tt) {
+  if (depth <= 0) return 1ULL;
 
-  const Color us = b.side_to_move();
   std::uint64_t nodes = 0ULL;
+  // Probe before generating: a hit costs no movegen (depth 1 is never cached)
+  if (depth >= 2 && tt && tt->probe(b.hash(), depth, nodes)) return nodes;
+
+  MoveList ml;
+  generate_legal(b, ml);       // legal only: no make/unmake just to reject a move
+  if (depth == 1) return ml.size();
 
   for (const auto& m : ml) {
-    State st{};                // <-- match your existing type
+    State st{};
     do_move(b, m, st);
-    if (!in_check(b, us)) {    // legal only if our king not in check after move
-      nodes += perft_mut(b, depth - 1);
-    }
+    nodes += perft_mut(b, depth - 1, tt);
     undo_move(b, m, st);
   }
+
+  if (tt) tt->store(b.hash(), depth, nodes);
   return nodes;
 }
 
-std::uint64_t perft(const Board& b, int depth) {
-  Board copy = b;              // copy once at root
-  return perft_mut(copy, depth);
+// ---- Parallel perft: expand the first plies into work items, then let a pool
+// of workers (each with its own Board) pull items off a shared counter. ----
+
+namespace {
+
+struct WorkItem {
+  std::size_t root;        // index of the root move this subtree belongs to
+  std::vector<Move> line;  // moves from the root position (line[0] = root move)
+};
+
+void expand(Board& b, int plies, std::size_t root, std::vector<Move>& line,
+            std::vector<WorkItem>& items) {
+  if (plies == 0) { items.push_back(WorkItem{root, line}); return; }
+  MoveList ml;
+  generate_legal(b, ml);
+  for (const auto& m : ml) {
+    State st{};
+    do_move(b, m, st);
+    line.push_back(m);
+    expand(b, plies - 1, root, line, items);
+    line.pop_back();
+    undo_move(b, m, st);
+  }
+}
+
+// perft(depth) split by root move (depth >= 2); per_root[i] matches roots[i].
+void perft_roots(const Board& b, int depth, const PerftOptions& opt,
+                 const MoveList& roots, std::vector<std::uint64_t>& per_root) {
+  per_root.assign(roots.size(), 0ULL);
+  const int threads = std::max(1, opt.threads);
+
+  // Auto split: root moves alone if there are plenty per thread, else one ply deeper.
+  int split = opt.split_depth;
+  if (split <= 0) split = (roots.size() >= 4 * static_cast<std::size_t>(threads)) ? 1 : 2;
+  split = std::clamp(split, 1, depth - 1);
+
+  std::vector<WorkItem> items;
+  {
+    Board root = b;
+    std::vector<Move> line;
+    for (std::size_t i = 0; i < roots.size(); ++i) {
+      const Move m = roots.data[i];
+      State st{};
+      do_move(root, m, st);
+      line.push_back(m);
+      expand(root, split - 1, i, line, items);
+      line.pop_back();
+      undo_move(root, m, st);
+    }
+  }
+
+  std::vector<std::uint64_t> counts(items.size(), 0ULL);
+  std::atomic<std::size_t> next{0};
+  auto worker = [&]() {
+    for (;;) {
+      const std::size_t k = next.fetch_add(1, std::memory_order_relaxed);
+      if (k >= items.size()) return;
+      Board local = b;
+      for (const Move& m : items[k].line) {
+        State st{};
+        do_move(local, m, st);
+      }
+      counts[k] = perft_mut(local, depth - split, opt.tt);
+    }
+  };
+
+  if (threads == 1) {
+    worker();
+  } else {
+    std::vector<std::thread> pool;
+    pool.reserve(static_cast<std::size_t>(threads));
+    for (int t = 0; t < threads; ++t) pool.emplace_back(worker);
+    for (auto& th : pool) th.join();
+  }
+
+  for (std::size_t k = 0; k < items.size(); ++k) per_root[items[k].root] += counts[k];
+}
+
+} // namespace
+
+std::uint64_t perft(const Board& b, int depth, const PerftOptions& opt) {
+  if (opt.threads <= 1 || depth < 2) {
+    Board copy = b;            // copy once at root
+    return perft_mut(copy, depth, opt.tt);
+  }
+
+  MoveList roots;
+  generate_legal(b, roots);
+  std::vector<std::uint64_t> per_root;
+  perft_roots(b, depth, opt, roots, per_root);
+  std::uint64_t nodes = 0ULL;
+  for (std::uint64_t n : per_root) nodes += n;
+  return nodes;
 }
 
 // New: per-move breakdown at root
 void perft_divide(const Board& b, int depth,
-                  std::vector<std::pair<Move, std::uint64_t>>& out) {
+                  std::vector<std::pair<Move, std::uint64_t>>& out,
+                  const PerftOptions& opt) {
   out.clear();
   if (depth <= 0) return;
 
-  Board root = b;
-  MoveList ml;
-  generate_pseudo_legal(root, ml);
-  const Color us = root.side_to_move();
+  MoveList roots;
+  generate_legal(b, roots);
+
+  if (opt.threads > 1 && depth >= 2) {
+    std::vector<std::uint64_t> per_root;
+    perft_roots(b, depth, opt, roots, per_root);
+    for (std::size_t i = 0; i < roots.size(); ++i) out.emplace_back(roots.data[i], per_root[i]);
+    return;
+  }
 
-  for (const auto& m : ml) {   // <-- same pattern as above
+  Board root = b;
+  for (const auto& m : roots) {
     State st{};
     do_move(root, m, st);
-    if (!in_check(root, us)) {
-      std::uint64_t n = perft(root, depth - 1);
-      out.emplace_back(m, n);
-    }
+    std::uint64_t n = perft_mut(root, depth - 1, opt.tt);
+    out.emplace_back(m, n);
     undo_move(root, m, st);
   }
 }
 
+bool parse_perft_epd(std::string_view line, PerftEpd& out) {
+  out = PerftEpd{};
+  const std::size_t semi = line.find(';');
+  if (semi == std::string_view::npos) return false;
+
+  // FEN: whitespace-normalized, padded to 6 fields
+  std::istringstream fs{std::string(line.substr(0, semi))};
+  std::string tok;
+  int fields = 0;
+  while (fs >> tok) {
+    if (fields == 0 && tok[0] == '#') return false;
+    if (fields++) out.fen.push_back(' ');
+    out.fen += tok;
+  }
+  if (fields == 4) out.fen += " 0 1";
+  else if (fields != 6) return false;
+
+  // ";D<depth> <nodes>" entries; anything else is ignored
+  std::size_t pos = semi;
+  while (pos != std::string_view::npos) {
+    const std::size_t next = line.find(';', pos + 1);
+    std::istringstream es{std::string(line.substr(pos + 1, next == std::string_view::npos ? next : next - pos - 1))};
+    std::string tag;
+    std::uint64_t nodes = 0;
+    if (es >> tag >> nodes && tag.size() >= 2 && tag[0] == 'D') {
+      try { out.refs.emplace_back(std::stoi(tag.substr(1)), nodes); } catch (...) {}
+    }
+    pos = next;
+  }
+  return !out.refs.empty();
+}
+
 } // namespace euclid
@@ -4,6 +4,7 @@
 #include "euclid/move_do.hpp"
 #include "euclid/attack.hpp"
 #include "euclid/eval.hpp"
+#include "euclid/see.hpp"
 #include "euclid/tt.hpp"
 #include "euclid/types.hpp"
 
@@ -14,6 +15,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace euclid {
@@ -24,142 +28,308 @@ namespace {
 // -----------------------------------------------------------------------------
 constexpr int MAX_PLY = 128;
 
-static Move killer1[MAX_PLY];
-static Move killer2[MAX_PLY];
-static int  historyH[2][64][64];
-static int  g_rootDepth = 0;
-
-// Limits
-static bool g_has_deadline = false;
-static std::chrono::steady_clock::time_point g_deadline;
-static std::uint64_t g_node_limit = 0; // 0 => unlimited
+// Per-thread search state. Under Lazy SMP every thread owns one of these (move
+// ordering tables, node limit, eval-cache telemetry); the TT and eval cache are
+// shared through ctx.
+struct ThreadData {
+  SearchContext::State* ctx = nullptr;
+
+  Move killer1[MAX_PLY]{};
+  Move killer2[MAX_PLY]{};
+  int  historyH[2][64][64]{};
+  std::uint64_t nodeLimit = 0; // 0 => unlimited
+
+  // Eval cache telemetry (per thread, so non-atomic is fine)
+  std::uint64_t evalProbes = 0;
+  std::uint64_t evalHits   = 0;
+  std::uint64_t evalStores = 0;
+};
 
-// -----------------------------------------------------------------------------
 // Eval cache (Zobrist-keyed) for expensive static evaluation calls
 // Stores POV = side-to-move (negamax handles sign).
 // Direct-mapped + generation tagging for O(1) invalidation.
+// Each entry is one atomic word (key tag | generation | eval), so threads can
+// share the cache without ever reading a torn entry.
+constexpr std::size_t EVAL_CACHE_SIZE = 1u << 18; // 262,144 entries
+constexpr std::size_t EVAL_CACHE_MASK = EVAL_CACHE_SIZE - 1u;
+constexpr U64 EVAL_TAG_MASK = 0xFFFFFFFF00000000ULL; // high key bits; low bits pick the slot
+
+} // namespace (anon)
+
 // -----------------------------------------------------------------------------
-struct EvalCacheEntry {
-  U64 key{0};
-  int eval_stm{0};
-  std::uint32_t gen{0};
-};
+// Everything a search reads or writes besides its own stack: one per
+// SearchContext, so independent contexts never share state.
+// -----------------------------------------------------------------------------
+struct SearchContext::State {
+  TT tt;
+  std::vector<std::atomic<U64>> evalCache;
+  std::uint16_t evalGen = 1;
 
-static constexpr std::size_t EVAL_CACHE_SIZE = 1u << 18; // 262,144 entries
-static constexpr std::size_t EVAL_CACHE_MASK = EVAL_CACHE_SIZE - 1u;
-static std::array<EvalCacheEntry, EVAL_CACHE_SIZE> g_eval_cache{};
-static std::uint32_t g_eval_gen = 1;
+  // The searching caller's tables; kept across searches (helpers start fresh).
+  ThreadData main;
 
-// Telemetry (single-threaded; non-atomic is fine)
-static std::uint64_t g_eval_cache_probes = 0;
-static std::uint64_t g_eval_cache_hits   = 0;
-static std::uint64_t g_eval_cache_stores = 0;
+  // Limits of the running search
+  bool hasDeadline = false;
+  std::chrono::steady_clock::time_point deadline;
 
-static inline void eval_cache_reset_stats() {
-  g_eval_cache_probes = 0;
-  g_eval_cache_hits   = 0;
-  g_eval_cache_stores = 0;
+  State() : evalCache(EVAL_CACHE_SIZE) { main.ctx = this; }
+  explicit State(std::size_t ttBytes) : tt(ttBytes), evalCache(EVAL_CACHE_SIZE) { main.ctx = this; }
+};
+
+namespace {
+
+static inline void eval_cache_reset_stats(SearchContext::State& ctx) {
+  ctx.main.evalProbes = 0;
+  ctx.main.evalHits   = 0;
+  ctx.main.evalStores = 0;
 }
 
-static inline void eval_cache_clear() {
-  ++g_eval_gen;
-  if (g_eval_gen == 0) {
-    // Extremely unlikely wrap: force all entries invalid.
-    for (auto& e : g_eval_cache) e.gen = 0;
-    g_eval_gen = 1;
+static inline void eval_cache_clear(SearchContext::State& ctx) {
+  ++ctx.evalGen;
+  if (ctx.evalGen == 0) {
+    // Generation wrapped: force all entries invalid.
+    for (auto& e : ctx.evalCache) e.store(0, std::memory_order_relaxed);
+    ctx.evalGen = 1;
   }
-  eval_cache_reset_stats();
+  eval_cache_reset_stats(ctx);
 }
 
 // -----------------------------------------------------------------------------
 // Small utilities
 // -----------------------------------------------------------------------------
-inline bool same_move(const Move& a, const Move& b) {
-  return a.from == b.from && a.to == b.to && a.promo == b.promo;
-}
-
 inline Color other_color(Color c) {
   return (c == Color::White) ? Color::Black : Color::White;
 }
 
-inline bool square_has_opponent(const Board& b, Color us, int sq) {
-  Color oc;
-  Piece op = b.piece_at(sq, &oc);
-  return op != Piece::None && oc != us;
-}
-
-inline bool is_quiet(const Board& b, Color us, const Move& m) {
-  if (m.promo != Piece::None) return false;
-  return !square_has_opponent(b, us, m.to);
+// Captures, en passant and promotions are searched in the capture stage.
+inline bool is_tactical(const Move& m) {
+  return m.is_capture() || m.is_promotion();
 }
 
-inline void store_killer_history(Color us, const Board& b, const Move& m, int ply) {
+inline void store_killer_history(ThreadData& td, Color us, const Move& m, int ply) {
   if (ply < 0 || ply >= MAX_PLY) return;
-  if (is_quiet(b, us, m)) {
-    if (!same_move(killer1[ply], m)) {
-      killer2[ply] = killer1[ply];
-      killer1[ply] = m;
+  if (!is_tactical(m)) {
+    if (td.killer1[ply] != m) {
+      td.killer2[ply] = td.killer1[ply];
+      td.killer1[ply] = m;
     }
-    int& h = historyH[(int)us][m.from][m.to];
+    int& h = td.historyH[(int)us][m.from()][m.to()];
     h += (ply + 1) * (ply + 1);
     if (h > (1 << 20)) { // cheap decay
       for (int c = 0; c < 2; ++c)
         for (int f = 0; f < 64; ++f)
           for (int t = 0; t < 64; ++t)
-            historyH[c][f][t] >>= 1;
+            td.historyH[c][f][t] >>= 1;
     }
   }
 }
 
-inline int mvv_lva(const Board& b, const Move& m) {
-  Color oc;
-  Piece victim = b.piece_at(m.to, &oc);
+// victim comes from the generator (MoveList::captured), so only the mover is read from the board.
+inline int mvv_lva(const Board& b, const Move& m, Piece victim) {
   if (victim == Piece::None) return 0;
 
-  Color uc;
-  Piece attacker = b.piece_at(m.from, &uc);
+  Piece attacker = b.piece_at(m.from());
 
-  static const int val[] = {0, 100, 320, 330, 500, 900, 20000}; // None,P,N,B,R,Q,K
+  static const int val[] = {100, 320, 330, 500, 900, 1000, 0}; // P,N,B,R,Q,K,None
   return val[(int)victim] * 16 - val[(int)attacker];
 }
 
-// Killer/history aware sorting score (captures, promo, TT first; then killers; then history)
-inline int order_score(const Board& b, Color us, const Move& m, int ply, const Move& ttMove) {
-  if (same_move(m, ttMove)) return 3'000'000;
-  if (m.promo != Piece::None) return 2'600'000;                 // promotions
-  if (square_has_opponent(b, us, m.to)) return 2'000'000 + mvv_lva(b, m);
-  if (ply >= 0 && ply < MAX_PLY) {
-    if (same_move(m, killer1[ply])) return 1'500'000;
-    if (same_move(m, killer2[ply])) return 1'400'000;
-  }
-  return historyH[(int)us][m.from][m.to];                        // quiets
+// Promotions first, then MVV-LVA.
+inline int capture_score(const Board& b, const Move& m, Piece victim) {
+  if (m.is_promotion()) return 1'000'000 + (int)m.promo();
+  return mvv_lva(b, m, victim);
 }
 
-// Capture-like test BEFORE making a move (needed for LMR gating)
-inline bool is_en_passant_pre(const Board& b, Color us, const Move& m) {
-  Color fc;
-  Piece fromP = b.piece_at(m.from, &fc);
-  if (fromP != Piece::Pawn || fc != us) return false;
-  if (file_of(m.from) == file_of(m.to)) return false;
-  return b.ep_square() == m.to;
-}
+// -----------------------------------------------------------------------------
+// Staged move picker: TT move, winning/equal captures (scored once, picked
+// incrementally, SEE-checked when picked), killers, quiets by history, then the
+// losing captures. The TT move and killers are validated with is_pseudo_legal +
+// is_legal and tried before anything is generated; captures come from
+// generate_captures and quiets are only generated once a node gets past its
+// captures and killers without a cutoff.
+// In check the stages collapse into one list from generate_evasions.
+// -----------------------------------------------------------------------------
+class MovePicker {
+public:
+  // capturesOnly: stop after the capture stage (quiescence without check); losing
+  // captures are then dropped instead of deferred. Ignored in check, where every
+  // evasion is returned.
+  MovePicker(const Board& b, const ThreadData& td, const Move& ttMove, int ply, bool capturesOnly)
+    : b_(b), td_(td), tt_(ttMove), ply_(ply), capturesOnly_(capturesOnly) {
+    // The TT move may come from a key collision: check it against this position.
+    hasTT_ = !tt_.is_null() && (!capturesOnly_ || is_tactical(tt_) || b_.checkers()) &&
+             is_pseudo_legal(b_, tt_) && is_legal(b_, tt_);
+    if (b_.checkers()) stage_ = hasTT_ ? Stage::EvasionTT : Stage::InitEvasions;
+  }
 
-inline bool is_capture_like_pre(const Board& b, Color us, const Move& m) {
-  Color tc;
-  Piece toP = b.piece_at(m.to, &tc);
-  const bool isDirectCap = (toP != Piece::None && tc != us);
-  return isDirectCap || is_en_passant_pre(b, us, m);
-}
+  bool next(Move& out) {
+    switch (stage_) {
+    case Stage::EvasionTT:
+      stage_ = Stage::InitEvasions;
+      out = tt_;
+      return true;
+
+    case Stage::InitEvasions: {
+      // Captures by MVV-LVA ahead of killers ahead of quiets by history.
+      generate_evasions(b_, caps_);
+      const int us = (int)b_.side_to_move();
+      for (std::size_t i = 0; i < caps_.sz; ++i) {
+        const Move& m = caps_.data[i];
+        if (is_tactical(m))          capScore_[i] = (1 << 28) + capture_score(b_, m, caps_.captured(i));
+        else if (m == killer(0))     capScore_[i] = (1 << 27);
+        else if (m == killer(1))     capScore_[i] = (1 << 27) - 1;
+        else                         capScore_[i] = td_.historyH[us][m.from()][m.to()];
+      }
+      cur_ = 0;
+      stage_ = Stage::Evasions;
+    }
+      [[fallthrough]];
+
+    case Stage::Evasions:
+      while (cur_ < caps_.sz) {
+        const Move m = pick_best(caps_, capScore_, cur_++);
+        if (hasTT_ && m == tt_) continue;
+        out = m;
+        return true;
+      }
+      stage_ = Stage::Done;
+      return false;
+
+    case Stage::TT:
+      stage_ = Stage::InitCaptures;
+      if (hasTT_) { out = tt_; return true; }
+      [[fallthrough]];
+
+    case Stage::InitCaptures:
+      generate_captures(b_, caps_);
+      for (std::size_t i = 0; i < caps_.sz; ++i) {
+        capScore_[i] = capture_score(b_, caps_.data[i], caps_.captured(i));
+      }
+      cur_ = 0;
+      stage_ = Stage::Captures;
+      [[fallthrough]];
+
+    case Stage::Captures:
+      while (cur_ < caps_.sz) {
+        const Move m = pick_best(caps_, capScore_, cur_++);
+        if (hasTT_ && m == tt_) continue;
+        if (!m.is_promotion() && !see_ge(b_, m, 0)) {
+          if (!capturesOnly_) bad_.push(m);
+          continue;
+        }
+        out = m;
+        return true;
+      }
+      if (capturesOnly_) { stage_ = Stage::Done; return false; }
+      stage_ = Stage::Killers;
+      [[fallthrough]];
+
+    case Stage::Killers:
+      // Killers are quiet moves from sibling nodes: validate them here, before
+      // any quiet move has been generated.
+      while (killerIdx_ < 2) {
+        const Move k = killer(killerIdx_++);
+        if (k.is_null() || is_tactical(k)) continue;
+        if (hasTT_ && k == tt_) continue;
+        if (!is_pseudo_legal(b_, k) || !is_legal(b_, k)) continue;
+        killers_[numKillers_++] = k;
+        out = k;
+        return true;
+      }
+      stage_ = Stage::InitQuiets;
+      [[fallthrough]];
+
+    case Stage::InitQuiets: {
+      generate_quiets(b_, quiets_);
+      const int us = (int)b_.side_to_move();
+      for (std::size_t i = 0; i < quiets_.sz; ++i) {
+        const Move& m = quiets_.data[i];
+        quietScore_[i] = td_.historyH[us][m.from()][m.to()];
+      }
+      cur_ = 0;
+      stage_ = Stage::Quiets;
+    }
+      [[fallthrough]];
+
+    case Stage::Quiets:
+      while (cur_ < quiets_.sz) {
+        const Move m = pick_best(quiets_, quietScore_, cur_++);
+        if (hasTT_ && m == tt_) continue;
+        if (is_killer_played(m)) continue;
+        out = m;
+        return true;
+      }
+      cur_ = 0;
+      stage_ = Stage::BadCaptures;
+      [[fallthrough]];
+
+    case Stage::BadCaptures:
+      // Already in MVV-LVA order from the capture stage
+      if (cur_ < bad_.sz) { out = bad_.data[cur_++]; return true; }
+      stage_ = Stage::Done;
+      [[fallthrough]];
+
+    case Stage::Done:
+      break;
+    }
+    return false;
+  }
+
+private:
+  enum class Stage : std::uint8_t {
+    EvasionTT, InitEvasions, Evasions,
+    TT, InitCaptures, Captures, Killers, InitQuiets, Quiets, BadCaptures,
+    Done
+  };
+  using Scores = std::array<int, MoveList::CAP>;
+
+  Move killer(int i) const {
+    if (ply_ < 0 || ply_ >= MAX_PLY) return Move{};
+    return i == 0 ? td_.killer1[ply_] : td_.killer2[ply_];
+  }
+
+  bool is_killer_played(const Move& m) const {
+    for (int i = 0; i < numKillers_; ++i) {
+      if (killers_[i] == m) return true;
+    }
+    return false;
+  }
+
+  // Selection step: move the best-scored entry of [i, end) to i and return it.
+  static Move pick_best(MoveList& ml, Scores& score, std::size_t i) {
+    std::size_t best = i;
+    for (std::size_t j = i + 1; j < ml.sz; ++j) {
+      if (score[j] > score[best]) best = j;
+    }
+    if (best != i) {
+      std::swap(ml.data[i], ml.data[best]);
+      std::swap(score[i], score[best]);
+    }
+    return ml.data[i];
+  }
+
+  const Board& b_;
+  const ThreadData& td_;
+  Move tt_;
+  int  ply_;
+  bool capturesOnly_;
+  bool hasTT_ = false;
+
+  Stage stage_ = Stage::TT;
+  MoveList caps_;      // evasions when in check
+  MoveList quiets_;
+  MoveList bad_;       // captures that failed see_ge(0), searched after the quiets
+  Scores capScore_;    // filled before use
+  Scores quietScore_;
+  std::size_t cur_ = 0;
+  int killerIdx_ = 0;
+  std::array<Move, 2> killers_{};  // killers already returned by the Killers stage
+  int numKillers_ = 0;
+};
 
 // Conservative gating for null-move pruning: avoid pawn/king-only endings (zugzwang risk)
 inline bool has_non_pawn_material(const Board& b, Color c) {
-  for (int sq = 0; sq < 64; ++sq) {
-    Color pc;
-    Piece p = b.piece_at(sq, &pc);
-    if (p == Piece::None || pc != c) continue;
-    if (p != Piece::Pawn && p != Piece::King) return true;
-  }
-  return false;
+  return (b.occupancy(c) & ~b.pieces(c, Piece::Pawn) & ~b.pieces(c, Piece::King)) != 0ULL;
 }
 
 struct NullState {
@@ -191,12 +361,14 @@ inline void undo_null_move(Board& b, const NullState& ns) {
 }
 
 // -----------------------------------------------------------------------------
-// Stop/limit checks (guarantee nodes <= node_limit when node_limit > 0)
+// Stop/limit checks (guarantee nodes <= nodeLimit when nodeLimit > 0; only the
+// main thread has a limit, and a node-limited search runs without helpers, so
+// this bounds the reported total too)
 // -----------------------------------------------------------------------------
-inline bool should_abort(std::uint64_t& nodes, std::atomic<bool>* stopFlag) {
+inline bool should_abort(const ThreadData& td, std::uint64_t& nodes, std::atomic<bool>* stopFlag) {
   if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return true;
 
-  if (g_node_limit > 0 && nodes >= g_node_limit) {
+  if (td.nodeLimit > 0 && nodes >= td.nodeLimit) {
     if (stopFlag) stopFlag->store(true, std::memory_order_relaxed);
     return true;
   }
@@ -204,8 +376,8 @@ inline bool should_abort(std::uint64_t& nodes, std::atomic<bool>* stopFlag) {
   ++nodes;
 
   // Deadline polling (periodic to reduce overhead)
-  if (stopFlag && g_has_deadline && ((nodes & 0x3FFFu) == 0u)) {
-    if (std::chrono::steady_clock::now() >= g_deadline) {
+  if (stopFlag && td.ctx->hasDeadline && ((nodes & 0x3FFFu) == 0u)) {
+    if (std::chrono::steady_clock::now() >= td.ctx->deadline) {
       stopFlag->store(true, std::memory_order_relaxed);
       return true;
     }
@@ -237,141 +409,86 @@ static inline int eval_side_to_move_uncached(const Board& b) {
   return b.side_to_move() == Color::White ? e : -e;
 }
 
-static inline int eval_side_to_move_cached_key(const Board& b, U64 key) {
-  ++g_eval_cache_probes;
-  EvalCacheEntry& e = g_eval_cache[static_cast<std::size_t>(key) & EVAL_CACHE_MASK];
-  if (e.gen == g_eval_gen && e.key == key) {
-    ++g_eval_cache_hits;
-    return e.eval_stm;
+static inline int eval_side_to_move_cached_key(ThreadData& td, const Board& b, U64 key) {
+  ++td.evalProbes;
+  SearchContext::State& ctx = *td.ctx;
+  std::atomic<U64>& slot = ctx.evalCache[static_cast<std::size_t>(key) & EVAL_CACHE_MASK];
+  const U64 e = slot.load(std::memory_order_relaxed);
+  if ((e & EVAL_TAG_MASK) == (key & EVAL_TAG_MASK) &&
+      static_cast<std::uint16_t>(e >> 16) == ctx.evalGen) {
+    ++td.evalHits;
+    return static_cast<std::int16_t>(e & 0xFFFFu);
   }
 
   const int v = eval_side_to_move_uncached(b);
-  e.key = key;
-  e.eval_stm = v;
-  e.gen = g_eval_gen;
-  ++g_eval_cache_stores;
+  if (v >= std::numeric_limits<std::int16_t>::min() && v <= std::numeric_limits<std::int16_t>::max()) {
+    slot.store((key & EVAL_TAG_MASK) | (static_cast<U64>(ctx.evalGen) << 16) |
+               static_cast<std::uint16_t>(static_cast<std::int16_t>(v)),
+               std::memory_order_relaxed);
+    ++td.evalStores;
+  }
   return v;
 }
 
-static inline int eval_side_to_move(const Board& b) {
-  return eval_side_to_move_cached_key(b, b.hash());
+static inline int eval_side_to_move(ThreadData& td, const Board& b) {
+  return eval_side_to_move_cached_key(td, b, b.hash());
 }
 
-// -----------------------------------------------------------------------------
-// Global TT
-// -----------------------------------------------------------------------------
-static TT GTT;
-
 // -----------------------------------------------------------------------------
 // Quiescence (captures/promo/EP; full evasions if in check)
 // -----------------------------------------------------------------------------
-static int move_score_basic(const Board& b, Color us, const Move& m) {
-  static const int PVAL[7] = {0, 100, 320, 330, 500, 900, 20000};
-  Color fc; Piece fromP = b.piece_at(m.from, &fc);
-  Color tc; Piece toP   = b.piece_at(m.to, &tc);
-
-  int promo_bonus = 0;
-  if (m.promo != Piece::None)
-    promo_bonus = PVAL[static_cast<int>(m.promo)] * 10;
-
-  if (toP != Piece::None && tc != us) {
-    int victim   = PVAL[static_cast<int>(toP)];
-    int attacker = PVAL[static_cast<int>(fromP)];
-    return 100000 + 10 * victim - attacker + promo_bonus;
-  }
-  if (is_en_passant_pre(b, us, m)) {
-    int attacker = PVAL[static_cast<int>(fromP)];
-    return 100000 + 10 * PVAL[static_cast<int>(Piece::Pawn)] - attacker + promo_bonus;
-  }
-  return promo_bonus; // quiet
-}
-
-static int qsearch(Board& b, int alpha, int beta, std::uint64_t& nodes,
+static int qsearch(Board& b, ThreadData& td, int alpha, int beta, std::uint64_t& nodes,
                    std::atomic<bool>* stopFlag, std::vector<U64>& keyHist)
 {
-  if (should_abort(nodes, stopFlag)) return alpha;
+  if (should_abort(td, nodes, stopFlag)) return alpha;
 
   // Rule draws (note: repetition is based on keyHist provided by the search line)
   if (is_rule_draw(b, keyHist)) return 0;
 
-  const Color us = b.side_to_move();
-
-  if (in_check(b, us)) {
-    MoveList ev;
-    generate_pseudo_legal(b, ev);
-
-    std::vector<Move> moves;
-    moves.reserve(ev.sz);
-    for (const auto& m : ev) moves.push_back(m);
-
-    std::stable_sort(moves.begin(), moves.end(),
-      [&](const Move& a, const Move& c) {
-        return move_score_basic(b, us, a) > move_score_basic(b, us, c);
-      });
-
-    for (const auto& m : moves) {
+  if (b.checkers()) {
+    // The picker switches to generate_evasions when in check.
+    MovePicker mp(b, td, Move{}, -1, /*capturesOnly=*/false);
+    bool anyLegal = false;
+    Move m{};
+    while (mp.next(m)) {
+      anyLegal = true;
       State st{};
       do_move(b, m, st);
       keyHist.push_back(b.hash());
 
-      if (!in_check(b, us)) {
-        int score = -qsearch(b, -beta, -alpha, nodes, stopFlag, keyHist);
-        keyHist.pop_back();
-        undo_move(b, m, st);
+      int score = -qsearch(b, td, -beta, -alpha, nodes, stopFlag, keyHist);
+      keyHist.pop_back();
+      undo_move(b, m, st);
 
-        if (score >= beta) return score;
-        if (score > alpha) alpha = score;
-      } else {
-        keyHist.pop_back();
-        undo_move(b, m, st);
-      }
+      if (score >= beta) return score;
+      if (score > alpha) alpha = score;
 
       if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return alpha;
     }
+    // Checkmated at the horizon: score it like negamax does (distance from root)
+    if (!anyLegal) return -MATE + std::min<int>(MAX_PLY - 1, (int)keyHist.size() - 1);
     return alpha;
   }
 
   // Stand pat
-  int stand = eval_side_to_move(b);
+  int stand = eval_side_to_move(td, b);
   if (stand >= beta) return stand;
   if (stand > alpha) alpha = stand;
 
   // Tactics only
-  MoveList ml;
-  generate_pseudo_legal(b, ml);
-
-  std::vector<Move> moves;
-  moves.reserve(ml.sz);
-  for (const auto& m : ml) {
-    Color tc;
-    Piece toP = b.piece_at(m.to, &tc);
-    bool isCap = (toP != Piece::None && tc != us);
-    bool isEP  = is_en_passant_pre(b, us, m);
-    bool isPr  = (m.promo != Piece::None);
-    if (isCap || isEP || isPr) moves.push_back(m);
-  }
-
-  std::stable_sort(moves.begin(), moves.end(),
-    [&](const Move& a, const Move& c) {
-      return move_score_basic(b, us, a) > move_score_basic(b, us, c);
-    });
-
-  for (const auto& m : moves) {
+  MovePicker mp(b, td, Move{}, -1, /*capturesOnly=*/true);
+  Move m{};
+  while (mp.next(m)) {
     State st{};
     do_move(b, m, st);
     keyHist.push_back(b.hash());
 
-    if (!in_check(b, us)) {
-      int score = -qsearch(b, -beta, -alpha, nodes, stopFlag, keyHist);
-      keyHist.pop_back();
-      undo_move(b, m, st);
+    int score = -qsearch(b, td, -beta, -alpha, nodes, stopFlag, keyHist);
+    keyHist.pop_back();
+    undo_move(b, m, st);
 
-      if (score >= beta) return score;
-      if (score > alpha) alpha = score;
-    } else {
-      keyHist.pop_back();
-      undo_move(b, m, st);
-    }
+    if (score >= beta) return score;
+    if (score > alpha) alpha = score;
 
     if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return alpha;
   }
@@ -382,11 +499,11 @@ static int qsearch(Board& b, int alpha, int beta, std::uint64_t& nodes,
 // -----------------------------------------------------------------------------
 // Negamax with TT + killers/history + PVS + LMR + check extension + null-move
 // -----------------------------------------------------------------------------
-static int negamax(Board& b, int depth, int alpha, int beta,
+static int negamax(Board& b, ThreadData& td, int depth, int alpha, int beta,
                    std::uint64_t& nodes, std::vector<Move>& pv,
                    std::atomic<bool>* stopFlag, std::vector<U64>& keyHist)
 {
-  if (should_abort(nodes, stopFlag)) { pv.clear(); return alpha; }
+  if (should_abort(td, nodes, stopFlag)) { pv.clear(); return alpha; }
 
   // Rule draws
   if (is_rule_draw(b, keyHist)) { pv.clear(); return 0; }
@@ -395,16 +512,19 @@ static int negamax(Board& b, int depth, int alpha, int beta,
   const U64 key = b.hash();
   const Color us = b.side_to_move();
   const int ply = std::min<int>(MAX_PLY - 1, (int)keyHist.size() - 1);
+  TT& tt = td.ctx->tt;
 
   const bool usInCheck = in_check(b, us);
   int staticEval = 0;
-  if (!usInCheck) staticEval = eval_side_to_move_cached_key(b, key);
+  if (!usInCheck) staticEval = eval_side_to_move_cached_key(td, b, key);
 
-  // TT probe (apply mate-distance on load)
+  // TT probe (apply mate-distance on load). No cutoff at the root: it would
+  // return without a PV (and so without a best move), e.g. when a Lazy SMP
+  // helper has already stored this iteration's root entry.
   TTEntry hit{};
   Move ttMove{};
-  bool haveTT = GTT.probe(key, hit);
-  if (haveTT && hit.depth >= depth) {
+  bool haveTT = tt.probe(key, hit);
+  if (haveTT && hit.depth >= depth && ply > 0) {
     ttMove = hit.best;
     int tts = from_tt_score(hit.score, ply);
     if (hit.bound == TTBound::Exact) { pv.clear(); return tts; }
@@ -415,17 +535,17 @@ static int negamax(Board& b, int depth, int alpha, int beta,
   }
 
   // Internal Iterative Deepening (seed a good ttMove on TT miss)
-  bool hasTTMove = (ttMove.from | ttMove.to | static_cast<int>(ttMove.promo)) != 0;
+  bool hasTTMove = !ttMove.is_null();
   if (!hasTTMove && depth >= 3) {
     std::vector<Move> seedPV;
-    (void)negamax(b, depth - 2, alpha, beta, nodes, seedPV, stopFlag, keyHist);
+    (void)negamax(b, td, depth - 2, alpha, beta, nodes, seedPV, stopFlag, keyHist);
     TTEntry rehit{};
-    if (GTT.probe(key, rehit)) ttMove = rehit.best;
+    if (tt.probe(key, rehit)) ttMove = rehit.best;
   }
 
   if (depth == 0) {
     pv.clear();
-    return qsearch(b, alpha, beta, nodes, stopFlag, keyHist);
+    return qsearch(b, td, alpha, beta, nodes, stopFlag, keyHist);
   }
 
   // Null-move pruning (conservative; non-PV only)
@@ -441,7 +561,7 @@ static int negamax(Board& b, int depth, int alpha, int beta,
       const int R = 2 + (depth / 4);
       const int nullDepth = std::max(0, depth - 1 - R);
 
-      int score = -negamax(b, nullDepth, -beta, -beta + 1, nodes, nullPV, stopFlag, keyHist);
+      int score = -negamax(b, td, nullDepth, -beta, -beta + 1, nodes, nullPV, stopFlag, keyHist);
 
       keyHist.pop_back();
       undo_null_move(b, ns);
@@ -449,7 +569,7 @@ static int negamax(Board& b, int depth, int alpha, int beta,
       if (stopFlag && stopFlag->load(std::memory_order_relaxed)) { pv.clear(); return alpha; }
 
       if (score >= beta) {
-        GTT.store(key, Move{}, (std::int16_t)depth,
+        tt.store(key, Move{}, (std::int16_t)depth,
                   (std::int16_t)to_tt_score(score, ply), TTBound::Lower);
         pv.clear();
         return score;
@@ -457,18 +577,8 @@ static int negamax(Board& b, int depth, int alpha, int beta,
     }
   }
 
-  // Generate and order
-  MoveList ml;
-  generate_pseudo_legal(b, ml);
-
-  std::vector<Move> moves;
-  moves.reserve(ml.sz);
-  for (const auto& m : ml) moves.push_back(m);
-
-  std::stable_sort(moves.begin(), moves.end(),
-    [&](const Move& a, const Move& bmv) {
-      return order_score(b, us, a, ply, ttMove) > order_score(b, us, bmv, ply, ttMove);
-    });
+  // Legal moves, produced stage by stage (TT, captures, killers, quiets)
+  MovePicker mp(b, td, ttMove, ply, /*capturesOnly=*/false);
 
   bool anyLegal = false;
   Move bestMove{};
@@ -478,10 +588,15 @@ static int negamax(Board& b, int depth, int alpha, int beta,
   bool firstMove = true;
   int moveIndex = 0;
 
-  for (const auto& m : moves) {
-    const bool isCapLike = is_capture_like_pre(b, us, m);
-    const bool isPromo   = (m.promo != Piece::None);
-    const bool isTT      = same_move(m, ttMove);
+  // Check squares / discovered-check candidates, shared by every move of this node
+  const CheckSquares checkSq = check_squares(b);
+
+  Move m{};
+  while (mp.next(m)) {
+    const bool isCapLike  = m.is_capture();
+    const bool isPromo    = m.is_promotion();
+    const bool isTT       = (m == ttMove);
+    const bool givesCheck = gives_check(b, m, checkSq);
 
     // Futility pruning at frontier: skip clearly hopeless quiets at depth==1
     if (depth == 1 && !usInCheck && !isCapLike && !isPromo) {
@@ -493,69 +608,63 @@ static int negamax(Board& b, int depth, int alpha, int beta,
     do_move(b, m, st);
     keyHist.push_back(b.hash());
 
-    if (!in_check(b, us)) {
-      anyLegal = true;
-      std::vector<Move> childPV;
+    anyLegal = true;
+    std::vector<Move> childPV;
 
-      // Check extension (after move)
-      const Color them = other_color(us);
-      const int ext = (in_check(b, them) && depth >= 2) ? 1 : 0;
+    // Check extension (decided before the move via gives_check)
+    const int ext = (givesCheck && depth >= 2) ? 1 : 0;
 
-      int baseDepth = depth - 1 + ext;
-      if (baseDepth >= depth) baseDepth = depth - 1;
+    int baseDepth = depth - 1 + ext;
+    if (baseDepth >= depth) baseDepth = depth - 1;
 
-      // LMR on late quiets (never reduce first PV move)
-      int R = 0;
-      if (!firstMove && depth >= 3 && !isCapLike && !isPromo && !isTT && moveIndex >= 4) {
-        R = 1;
-      }
-      int reducedDepth = std::max(0, baseDepth - R);
+    // LMR on late quiet non-checks (never reduce first PV move)
+    int R = 0;
+    if (!firstMove && depth >= 3 && !isCapLike && !isPromo && !isTT && !givesCheck && moveIndex >= 4) {
+      R = 1;
+    }
+    int reducedDepth = std::max(0, baseDepth - R);
 #ifndef NDEBUG
-      if (reducedDepth >= depth) reducedDepth = depth - 1;
+    if (reducedDepth >= depth) reducedDepth = depth - 1;
 #endif
 
-      int score;
-      if (firstMove) {
-        score = -negamax(b, baseDepth, -beta, -alpha, nodes, childPV, stopFlag, keyHist);
-      } else {
-        score = -negamax(b, reducedDepth, -(alpha + 1), -alpha, nodes, childPV, stopFlag, keyHist);
-        if (score > alpha) {
-          childPV.clear();
-          score = -negamax(b, baseDepth, -beta, -alpha, nodes, childPV, stopFlag, keyHist);
-        }
+    int score;
+    if (firstMove) {
+      score = -negamax(b, td, baseDepth, -beta, -alpha, nodes, childPV, stopFlag, keyHist);
+    } else {
+      score = -negamax(b, td, reducedDepth, -(alpha + 1), -alpha, nodes, childPV, stopFlag, keyHist);
+      if (score > alpha) {
+        childPV.clear();
+        score = -negamax(b, td, baseDepth, -beta, -alpha, nodes, childPV, stopFlag, keyHist);
       }
+    }
 
-      keyHist.pop_back();
-      undo_move(b, m, st);
+    keyHist.pop_back();
+    undo_move(b, m, st);
 
-      if (score > bestScore) {
-        bestScore = score;
-        bestMove = m;
-        bestChildPV = std::move(childPV);
-      }
+    if (score > bestScore) {
+      bestScore = score;
+      bestMove = m;
+      bestChildPV = std::move(childPV);
+    }
 
-      if (bestScore >= beta) {
-        if (!isCapLike && !isPromo) store_killer_history(us, b, m, ply);
+    if (bestScore >= beta) {
+      if (!isCapLike && !isPromo) store_killer_history(td, us, m, ply);
 
-        GTT.store(key, m, (std::int16_t)depth,
-                  (std::int16_t)to_tt_score(bestScore, ply), TTBound::Lower);
-        pv.clear();
-        return bestScore;
-      }
+      tt.store(key, m, (std::int16_t)depth,
+                (std::int16_t)to_tt_score(bestScore, ply), TTBound::Lower);
+      pv.clear();
+      return bestScore;
+    }
 
-      if (bestScore > alpha) alpha = bestScore;
-      firstMove = false;
-      ++moveIndex;
+    if (bestScore > alpha) alpha = bestScore;
+    firstMove = false;
+    ++moveIndex;
 
-      if (stopFlag && stopFlag->load(std::memory_order_relaxed)) { pv.clear(); return alpha; }
-    } else {
-      keyHist.pop_back();
-      undo_move(b, m, st);
-    }
+    if (stopFlag && stopFlag->load(std::memory_order_relaxed)) { pv.clear(); return alpha; }
   }
 
   if (!anyLegal) {
-    if (in_check(b, us)) return -MATE + ply; // checkmated
+    if (usInCheck) return -MATE + ply; // checkmated
     return 0;                                 // stalemate
   }
 
@@ -568,7 +677,7 @@ static int negamax(Board& b, int depth, int alpha, int beta,
   if (bestScore <= alphaOrig) bound = TTBound::Upper;
   else if (bestScore >= beta) bound = TTBound::Lower;
 
-  GTT.store(key, bestMove, (std::int16_t)depth,
+  tt.store(key, bestMove, (std::int16_t)depth,
             (std::int16_t)to_tt_score(bestScore, ply), bound);
 
   return bestScore;
@@ -597,8 +706,10 @@ static int compute_time_budget_ms(const Board& b, const SearchLimits& lim) {
 // -----------------------------------------------------------------------------
 // Core driver with limits (iterative deepening + aspiration windows)
 // -----------------------------------------------------------------------------
-static SearchResult search_with_limits(const Board& root, int maxDepth,
-                                       std::atomic<bool>* stopFlag)
+// firstDepth > 1 lets Lazy SMP helpers start their iterations out of step with
+// the main thread.
+static SearchResult search_with_limits(ThreadData& td, const Board& root, int firstDepth,
+                                       int maxDepth, std::atomic<bool>* stopFlag)
 {
   SearchResult res{};
   Board b = root;
@@ -611,22 +722,19 @@ static SearchResult search_with_limits(const Board& root, int maxDepth,
 
   int lastScore = 0;
 
-  for (int d = 1; d <= maxDepth; ++d) {
+  for (int d = firstDepth; d <= maxDepth; ++d) {
     std::vector<Move> pv;
     int alpha = -INF, beta = +INF;
 
-    if (d > 1) {
+    if (d > firstDepth) {
       int asp = 50 + 10 * d;
       alpha = clamp(lastScore - asp, -MATE, +MATE);
       beta  = clamp(lastScore + asp, -MATE, +MATE);
 
       while (true) {
-        g_rootDepth = d;
-        int score = negamax(b, d, alpha, beta, res.nodes, pv, stopFlag, keyHist);
+        int score = negamax(b, td, d, alpha, beta, res.nodes, pv, stopFlag, keyHist);
 
-        if (stopFlag && stopFlag->load(std::memory_order_relaxed)) {
-          return res.depth > 0 ? res : SearchResult{};
-        }
+        if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return res;
 
         if (score <= alpha) {
           int widen = (beta - alpha) * 2;
@@ -646,11 +754,10 @@ static SearchResult search_with_limits(const Board& root, int maxDepth,
         }
       }
     } else {
-      g_rootDepth = d;
-      int score = negamax(b, d, alpha, beta, res.nodes, pv, stopFlag, keyHist);
-      if (stopFlag && stopFlag->load(std::memory_order_relaxed)) {
-        return res.depth > 0 ? res : SearchResult{};
-      }
+      int score = negamax(b, td, d, alpha, beta, res.nodes, pv, stopFlag, keyHist);
+      // Stopped before finishing depth 1: no move, but the nodes already
+      // searched still count (search_smp adds a helper's to the total).
+      if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return res;
       lastScore = score;
       res.best  = pv.empty() ? Move{} : pv.front();
       res.pv    = std::move(pv);
@@ -662,18 +769,62 @@ static SearchResult search_with_limits(const Board& root, int maxDepth,
   return res;
 }
 
+// -----------------------------------------------------------------------------
+// Lazy SMP: threads - 1 helpers run the same iterative deepening on their own
+// board copy and ThreadData, sharing the context's TT and eval cache; odd helpers start
+// one ply deeper so the threads drift apart. The main thread's result is
+// reported (with every thread's nodes), and the helpers stop once it returns.
+// -----------------------------------------------------------------------------
+static SearchResult search_smp(SearchContext::State& ctx, const Board& root, int maxDepth,
+                               std::atomic<bool>* stopFlag, int threads)
+{
+  if (threads <= 1) return search_with_limits(ctx.main, root, 1, maxDepth, stopFlag);
+
+  std::atomic<bool> helperStop{false};
+  const std::size_t helpers = static_cast<std::size_t>(threads - 1);
+  std::vector<std::unique_ptr<ThreadData>> data(helpers);
+  std::vector<std::uint64_t> helperNodes(helpers, 0);
+  std::vector<std::thread> pool;
+  pool.reserve(helpers);
+
+  for (std::size_t i = 0; i < helpers; ++i) {
+    data[i] = std::make_unique<ThreadData>(); // node limit 0: only the main thread counts
+    data[i]->ctx = &ctx;
+    pool.emplace_back([&, i] {
+      const int first = std::min(maxDepth, 1 + static_cast<int>(i & 1u));
+      helperNodes[i] = search_with_limits(*data[i], root, first, maxDepth, &helperStop).nodes;
+    });
+  }
+
+  SearchResult res = search_with_limits(ctx.main, root, 1, maxDepth, stopFlag);
+
+  helperStop.store(true, std::memory_order_relaxed);
+  for (auto& t : pool) t.join();
+  for (std::uint64_t n : helperNodes) res.nodes += n;
+  return res;
+}
+
 } // namespace (anon)
 
 // ============================================================================
 // Public entry points (MUST be in namespace euclid)
 // ============================================================================
-SearchResult search(const Board& root, int maxDepth) {
-  g_has_deadline = false;
-  g_node_limit   = 0;
-  return search_with_limits(root, std::max(1, maxDepth), /*stopFlag=*/nullptr);
+SearchContext::SearchContext() : st_(std::make_unique<State>()) {}
+SearchContext::SearchContext(std::size_t ttBytes) : st_(std::make_unique<State>(ttBytes)) {}
+SearchContext::~SearchContext() = default;
+
+SearchResult SearchContext::search(const Board& root, int maxDepth) {
+  State& ctx = *st_;
+  ctx.hasDeadline   = false;
+  ctx.main.nodeLimit = 0;
+  ctx.tt.new_search();
+  SearchResult res = search_with_limits(ctx.main, root, 1, std::max(1, maxDepth), /*stopFlag=*/nullptr);
+  res.hashfull = ctx.tt.hashfull();
+  return res;
 }
 
-SearchResult search(const Board& root, const SearchLimits& lim) {
+SearchResult SearchContext::search(const Board& root, const SearchLimits& lim) {
+  State& ctx = *st_;
   std::atomic<bool> dummyStop{false};
   std::atomic<bool>* stopPtr = lim.stop ? lim.stop : &dummyStop;
 
@@ -682,33 +833,69 @@ SearchResult search(const Board& root, const SearchLimits& lim) {
     return SearchResult{};
   }
 
-  g_node_limit = lim.nodes;
+  ctx.main.nodeLimit = lim.nodes;
 
   const int depth = (lim.depth > 0) ? lim.depth : 6;
   const int budget_ms = compute_time_budget_ms(root, lim);
 
   if (budget_ms > 0) {
-    g_has_deadline = true;
-    g_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(budget_ms);
+    ctx.hasDeadline = true;
+    ctx.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(budget_ms);
   } else {
-    g_has_deadline = false;
+    ctx.hasDeadline = false;
   }
 
-  return search_with_limits(root, depth, stopPtr);
+  ctx.tt.new_search();
+  // Helpers would spend (and report) nodes past the limit: node-limited
+  // searches stay on one thread.
+  const int threads = lim.nodes > 0 ? 1 : lim.threads;
+  SearchResult res = search_smp(ctx, root, depth, stopPtr, threads);
+  res.hashfull = ctx.tt.hashfull();
+  return res;
+}
+
+void SearchContext::reset() {
+  State& ctx = *st_;
+  ctx.tt.clear();
+  for (int i = 0; i < MAX_PLY; ++i) { ctx.main.killer1[i] = Move{}; ctx.main.killer2[i] = Move{}; }
+  for (auto& byColor : ctx.main.historyH)
+    for (auto& byFrom : byColor)
+      for (int& h : byFrom) h = 0;
+  eval_cache_clear(ctx);
+}
+
+void SearchContext::resize_tt(std::size_t bytes) { st_->tt.resize(bytes); }
+
+SearchContext& default_search_context() {
+  static SearchContext ctx;
+  return ctx;
 }
 
+SearchResult search(const Board& root, int maxDepth) {
+  return default_search_context().search(root, maxDepth);
+}
+
+SearchResult search(const Board& root, const SearchLimits& lim) {
+  return default_search_context().search(root, lim);
+}
+
+void search_reset() { default_search_context().reset(); }
+
 // ============================================================================
 // Test hooks (no header changes; tests may declare these as extern)
+// All of them act on the default context.
 // ============================================================================
-std::uint64_t search_eval_cache_probes() { return g_eval_cache_probes; }
-std::uint64_t search_eval_cache_hits()   { return g_eval_cache_hits; }
-std::uint64_t search_eval_cache_stores() { return g_eval_cache_stores; }
+static SearchContext::State& default_state() { return default_search_context().state(); }
+
+std::uint64_t search_eval_cache_probes() { return default_state().main.evalProbes; }
+std::uint64_t search_eval_cache_hits()   { return default_state().main.evalHits; }
+std::uint64_t search_eval_cache_stores() { return default_state().main.evalStores; }
 
-void search_eval_cache_clear() { eval_cache_clear(); }
+void search_eval_cache_clear() { eval_cache_clear(default_state()); }
 
 // Deterministic: evaluates with cache enabled (POV = side-to-move).
 int search_debug_eval_stm(const Board& b) {
-  return eval_side_to_move_cached_key(b, b.hash());
+  return eval_side_to_move_cached_key(default_state().main, b, b.hash());
 }
 
 } // namespace euclid
@@ -0,0 +1,130 @@
+#include "euclid/see.hpp"
+
+#include <algorithm>
+
+#include "euclid/attack.hpp"
+#include "euclid/attacks_tbl.hpp"
+#include "euclid/bitboard.hpp"
+
+namespace euclid {
+
+namespace {
+
+inline Color other(Color c) { return c == Color::White ? Color::Black : Color::White; }
+
+// Exchange state on one square: who still attacks it through 'occ'.
+struct Exchange {
+  const Board& b;
+  Square to;
+  U64 occ;
+  U64 attackers;
+  U64 diag;  // bishops + queens, both colors
+  U64 orth;  // rooks + queens, both colors
+
+  Exchange(const Board& board, const Move& m) : b(board), to(m.to()) {
+    occ = b.occupancy() ^ square_bb(m.from());
+    if (m.flags() == MoveFlag::EnPassant) {
+      occ ^= square_bb(to + (b.side_to_move() == Color::White ? -8 : +8));
+    }
+    diag = b.pieces(Color::White, Piece::Bishop) | b.pieces(Color::Black, Piece::Bishop)
+         | b.pieces(Color::White, Piece::Queen)  | b.pieces(Color::Black, Piece::Queen);
+    orth = b.pieces(Color::White, Piece::Rook)   | b.pieces(Color::Black, Piece::Rook)
+         | b.pieces(Color::White, Piece::Queen)  | b.pieces(Color::Black, Piece::Queen);
+    attackers = attackers_to(b, to, occ) & occ;
+  }
+
+  // Remove side c's least valuable attacker, open the x-rays behind it and
+  // return its type (None when c has no attacker left).
+  Piece pop_least_valuable(Color c) {
+    const U64 mine = attackers & b.occupancy(c);
+    if (!mine) return Piece::None;
+    for (int p = static_cast<int>(Piece::Pawn); p <= static_cast<int>(Piece::King); ++p) {
+      const Piece pc = static_cast<Piece>(p);
+      const U64 bb = mine & b.pieces(c, pc);
+      if (!bb) continue;
+      occ ^= bb & (0ULL - bb);
+      if (pc == Piece::Pawn || pc == Piece::Bishop || pc == Piece::Queen) {
+        attackers |= bishop_attacks(to, occ) & diag;
+      }
+      if (pc == Piece::Rook || pc == Piece::Queen) {
+        attackers |= rook_attacks(to, occ) & orth;
+      }
+      attackers &= occ;
+      return pc;
+    }
+    return Piece::None;
+  }
+};
+
+// Value gained by the first capture (promotions add the piece upgrade).
+inline int first_gain(const Board& b, const Move& m) {
+  int v = (m.flags() == MoveFlag::EnPassant) ? see_value(Piece::Pawn) : see_value(b.piece_at(m.to()));
+  if (m.is_promotion()) v += see_value(m.promo()) - see_value(Piece::Pawn);
+  return v;
+}
+
+// Piece standing on the destination after the move.
+inline Piece mover(const Board& b, const Move& m) {
+  return m.is_promotion() ? m.promo() : b.piece_at(m.from());
+}
+
+} // namespace
+
+int see(const Board& b, const Move& m) {
+  if (m.flags() == MoveFlag::Castle) return 0;
+
+  // Classic swap list: gain[d] = value won at depth d if the exchange stops there.
+  int gain[32];
+  int d = 0;
+  gain[0] = first_gain(b, m);
+
+  Exchange ex(b, m);
+  Piece onSquare = mover(b, m);
+  Color c = other(b.side_to_move());
+  while (d < 31) {
+    const Piece next = ex.pop_least_valuable(c);
+    if (next == Piece::None) break;
+    ++d;
+    gain[d] = see_value(onSquare) - gain[d - 1];
+    // A king may only recapture if the square is no longer defended.
+    if (next == Piece::King && (ex.attackers & b.occupancy(other(c)))) { --d; break; }
+    onSquare = next;
+    c = other(c);
+  }
+  while (d > 0) {
+    gain[d - 1] = -std::max(-gain[d - 1], gain[d]);
+    --d;
+  }
+  return gain[0];
+}
+
+bool see_ge(const Board& b, const Move& m, int threshold) {
+  if (m.flags() == MoveFlag::Castle) return 0 >= threshold;
+
+  // 'swap' is how far we are above the threshold with the opponent to move.
+  int swap = first_gain(b, m) - threshold;
+  if (swap < 0) return false;                // even a free capture falls short
+  swap = see_value(mover(b, m)) - swap;
+  if (swap <= 0) return true;                // still fine after losing the mover
+
+  Exchange ex(b, m);
+  Color c = other(b.side_to_move());
+  bool res = true;
+  for (;;) {
+    const Piece next = ex.pop_least_valuable(c);
+    if (next == Piece::None) break;
+    // A king may only recapture if the square is no longer defended.
+    if (next == Piece::King) {
+      if (ex.attackers & b.occupancy(other(c))) break;
+      res = !res;
+      break;
+    }
+    res = !res;
+    swap = see_value(next) - swap;
+    if (swap < static_cast<int>(res)) break;
+    c = other(c);
+  }
+  return res;
+}
+
+} // namespace euclid
@@ -10,19 +10,10 @@
 
 namespace euclid {
 
-static bool has_any_legal_move(Board& b) {
+static bool has_any_legal_move(const Board& b) {
   MoveList ml;
-  generate_pseudo_legal(b, ml);
-
-  const Color us = b.side_to_move();
-  for (const auto& m : ml) {
-    State st{};
-    do_move(b, m, st);
-    const bool illegal = in_check(b, us);
-    undo_move(b, m, st);
-    if (!illegal) return true;
-  }
-  return false;
+  generate_legal(b, ml);
+  return !ml.empty();
 }
 
 GameReport selfplay_game(Board start, const SearchLimits& limIn, int maxPlies) {
@@ -78,16 +69,20 @@ GameReport selfplay_game(Board start, const SearchLimits& limIn, int maxPlies) {
     Move best = r.best;
 
     // Apply best move, verify legality the same way UCI does.
-    const Color us = b.side_to_move();
-    State st{};
-    do_move(b, best, st);
-    if (in_check(b, us)) {
-      undo_move(b, best, st);
+    MoveList legal;
+    generate_legal(b, legal);
+    bool found = false;
+    for (const auto& m : legal) {
+      if (m == best) { found = true; break; }
+    }
+    if (!found) {
       rep.outcome = GameOutcome::Aborted;
       rep.plies = ply;
       rep.reason = "engine produced illegal move";
       break;
     }
+    State st{};
+    do_move(b, best, st);
 
     rep.moves.push_back(best);
     history.push_back(b.hash());
@@ -1,57 +1,133 @@
 #include "euclid/tt.hpp"
 #include <algorithm>
+#include <limits>
 
 namespace euclid {
 
 static constexpr std::size_t DEFAULT_BYTES = 16ULL * 1024ULL * 1024ULL;
 
-TT::TT() { resize(DEFAULT_BYTES); }
-TT::TT(std::size_t bytes) { resize(bytes); }
+// Slot layout: bits 0-15 move, 16-31 score, 32-39 depth + 1 (0 = empty),
+// 40-41 bound, 42-47 generation (mod 64), 48-63 key >> 48
+static constexpr int GEN_BITS = 6;
+static constexpr unsigned GEN_MASK = (1u << GEN_BITS) - 1u;
+
+static inline std::uint16_t key_tag(U64 key) { return static_cast<std::uint16_t>(key >> 48); }
+
+static inline U64 pack(U64 key, const Move& best, std::int16_t depth, std::int16_t score,
+                       TTBound bound, unsigned gen) {
+  const int d = std::clamp<int>(depth, -1, 254) + 1;
+  return static_cast<U64>(best.data)
+       | (static_cast<U64>(static_cast<std::uint16_t>(score)) << 16)
+       | (static_cast<U64>(d) << 32)
+       | (static_cast<U64>(static_cast<std::uint8_t>(bound) & 3u) << 40)
+       | (static_cast<U64>(gen & GEN_MASK) << 42)
+       | (static_cast<U64>(key_tag(key)) << 48);
+}
 
-void TT::ensure_pow2(std::size_t& n) {
-  if (n == 0) { n = 1; return; }
-  // round up to power of two
-  n--;
-  n |= n >> 1;
-  n |= n >> 2;
-  n |= n >> 4;
-  n |= n >> 8;
-  n |= n >> 16;
-#if SIZE_MAX > 0xFFFFFFFFu
-  n |= n >> 32;
-#endif
-  n++;
+static inline bool occupied(U64 w) { return ((w >> 32) & 0xFFu) != 0; }
+static inline bool matches(U64 w, U64 key) { return occupied(w) && static_cast<std::uint16_t>(w >> 48) == key_tag(key); }
+static inline int depth_of(U64 w) { return static_cast<int>((w >> 32) & 0xFFu) - 1; }
+static inline unsigned gen_of(U64 w) { return static_cast<unsigned>(w >> 42) & GEN_MASK; }
+
+static inline void unpack(U64 w, TTEntry& out) {
+  out.best.data = static_cast<std::uint16_t>(w);
+  out.score     = static_cast<std::int16_t>(static_cast<std::uint16_t>(w >> 16));
+  out.depth     = static_cast<std::int16_t>(depth_of(w));
+  out.bound     = static_cast<TTBound>((w >> 40) & 3u);
 }
 
+TT::TT() { resize(DEFAULT_BYTES); }
+TT::TT(std::size_t bytes) { resize(bytes); }
+
 void TT::resize(std::size_t bytes) {
-  std::size_t n = bytes / sizeof(TTEntry);
-  if (n < 1) n = 1;
-  ensure_pow2(n);
-  entries_.assign(n, TTEntry{});
+  // Largest power of two that fits in 'bytes' (at least one bucket), so the
+  // table never exceeds the Hash budget
+  std::size_t n = 1;
+  while (n * 2 * sizeof(Bucket) <= bytes) n *= 2;
+  buckets_ = std::vector<Bucket>(n);
   mask_ = n - 1;
 }
 
 void TT::clear() {
-  std::fill(entries_.begin(), entries_.end(), TTEntry{});
+  for (auto& b : buckets_) {
+    for (auto& e : b.e) e.store(0, std::memory_order_relaxed);
+  }
 }
 
 bool TT::probe(U64 key, TTEntry& out) const {
-  const TTEntry& e = entries_[index(key)];
-  if (e.key == key && e.depth >= 0) { out = e; return true; }
+  for (const auto& e : buckets_[index(key)].e) {
+    const U64 w = e.load(std::memory_order_relaxed);
+    if (!matches(w, key)) continue;
+    unpack(w, out);
+    return out.depth >= 0;
+  }
   return false;
 }
 
 void TT::store(U64 key, const Move& best, std::int16_t depth,
                std::int16_t score, TTBound bound) {
-  TTEntry& e = entries_[index(key)];
-  // Replace if slot empty or new depth is better
-  if (e.depth < depth || e.key != key) {
-    e.key   = key;
-    e.best  = best;
-    e.depth = depth;
-    e.score = score;
-    e.bound = bound;
+  Bucket& bk = buckets_[index(key)];
+  const unsigned gen = generation_ & GEN_MASK;
+
+  // The choice of slot (and the kept move) is made from one snapshot of each
+  // word and committed with a CAS on that exact word: if another thread wrote
+  // the slot in between, decide again instead of mixing the two stores.
+  for (;;) {
+    std::atomic<U64>* victim = nullptr;
+    U64 victimOld = 0;
+    int victimValue = std::numeric_limits<int>::max();
+    Move move = best;
+
+    for (auto& e : bk.e) {
+      const U64 old = e.load(std::memory_order_relaxed);
+
+      if (!occupied(old)) {
+        // Empty slot: take it unless the key turns up later in the bucket
+        if (victimValue > std::numeric_limits<int>::min()) {
+          victim = &e;
+          victimOld = old;
+          victimValue = std::numeric_limits<int>::min();
+        }
+        continue;
+      }
+
+      if (matches(old, key)) {
+        // Same position: a deep entry from this search survives shallower, inexact results
+        if (bound != TTBound::Exact && gen_of(old) == gen && depth + 2 < depth_of(old)) return;
+        if (move.is_null()) move.data = static_cast<std::uint16_t>(old); // keep the known best move
+        victim = &e;
+        victimOld = old;
+        break;
+      }
+
+      // Another key: older and shallower goes first
+      const int age = static_cast<int>((gen - gen_of(old)) & GEN_MASK);
+      const int value = depth_of(old) - 8 * age;
+      if (value < victimValue) {
+        victim = &e;
+        victimOld = old;
+        victimValue = value;
+      }
+    }
+
+    if (victim->compare_exchange_weak(victimOld, pack(key, move, depth, score, bound, gen),
+                                      std::memory_order_relaxed, std::memory_order_relaxed)) {
+      return;
+    }
+  }
+}
+
+int TT::hashfull() const {
+  const std::size_t sample = std::min<std::size_t>(buckets_.size(), 1000 / BUCKET_ENTRIES);
+  const unsigned gen = generation_ & GEN_MASK;
+  std::size_t used = 0;
+  for (std::size_t i = 0; i < sample; ++i) {
+    for (const auto& e : buckets_[i].e) {
+      const U64 w = e.load(std::memory_order_relaxed);
+      if (occupied(w) && gen_of(w) == gen) ++used;
+    }
   }
+  return static_cast<int>(used * 1000 / (sample * BUCKET_ENTRIES));
 }
 
 } // namespace euclid
@@ -6,19 +6,24 @@
 #include "euclid/move_do.hpp"
 #include "euclid/movegen.hpp"
 #include "euclid/nn_eval.hpp"
+#include "euclid/perft.hpp"
 #include "euclid/search.hpp"
 #include "euclid/types.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cctype>
 #include <cstdint>
 #include <iostream>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 static std::atomic<bool> G_STOP{false};
+static int G_PERFT_HASH_MB = 16; // "go perft" cache size (0 = off)
+static int G_THREADS = 1;        // search threads (Lazy SMP) and go perft workers
 
 namespace euclid {
 
@@ -50,11 +55,11 @@ static inline char promo_to_char(Piece p) {
 std::string move_to_uci(const Move& m) {
   std::string s;
   s.reserve(5);
-  s.push_back(file_char(m.from));
-  s.push_back(rank_char(m.from));
-  s.push_back(file_char(m.to));
-  s.push_back(rank_char(m.to));
-  const char pc = promo_to_char(m.promo);
+  s.push_back(file_char(m.from()));
+  s.push_back(rank_char(m.from()));
+  s.push_back(file_char(m.to()));
+  s.push_back(rank_char(m.to()));
+  const char pc = promo_to_char(m.promo());
   if (pc) s.push_back(pc);
   return s;
 }
@@ -86,9 +91,9 @@ Move uci_to_move(const Board& b, const std::string& uci) {
   generate_pseudo_legal(b, ml);
 
   for (const auto& m : ml) {
-    if (m.from == from && m.to == to) {
-      if ((wantPromo == Piece::None && m.promo == Piece::None) ||
-          (wantPromo != Piece::None && m.promo == wantPromo)) {
+    if (m.from() == from && m.to() == to) {
+      if ((wantPromo == Piece::None && m.promo() == Piece::None) ||
+          (wantPromo != Piece::None && m.promo() == wantPromo)) {
         return m;
       }
     }
@@ -114,20 +119,16 @@ static std::string join_from(const std::vector<std::string>& toks, size_t start)
   return s;
 }
 
-// apply a sequence of UCI moves to a board (checks legality via in_check)
+// apply a sequence of UCI moves to a board (checks legality via is_legal, no make/unmake)
 static void apply_moves(Board& b, const std::vector<std::string>& toks, size_t startIdx) {
   for (size_t i = startIdx; i < toks.size(); ++i) {
     const std::string& u = toks[i];
     Move m = uci_to_move(b, u);
 
-    const Color us = b.side_to_move(); // capture mover color before do_move flips
+    if (!is_legal(b, m)) break; // stop applying moves; keep position at last legal
+
     State st{};
     do_move(b, m, st);
-
-    if (in_check(b, us)) { // illegal if our king in check after move
-      undo_move(b, m, st);
-      break; // stop applying moves; keep position at last legal
-    }
   }
 }
 
@@ -164,6 +165,35 @@ static void handle_setoption(const std::vector<std::string>& tokens) {
       (void)neural_eval_load_file(value);
     }
   }
+  else if (name == "PerftHash" && !value.empty()) {
+    try { G_PERFT_HASH_MB = std::clamp(std::stoi(value), 0, 4096); } catch (...) {}
+  }
+  else if (name == "Hash" && !value.empty()) {
+    try {
+      const int mb = std::clamp(std::stoi(value), 1, 65536);
+      default_search_context().resize_tt(static_cast<std::size_t>(mb) * 1024ULL * 1024ULL);
+    } catch (...) {}
+  }
+  else if (name == "Threads" && !value.empty()) {
+    try { G_THREADS = std::clamp(std::stoi(value), 1, 256); } catch (...) {}
+  }
+}
+
+// go perft <depth>: per-move counts, then the total (same layout as other engines).
+// Runs on the Threads option's worker count and shares the PerftHash cache.
+static void run_perft(const Board& b, int depth, std::ostream& out) {
+  std::optional<PerftTT> tt;
+  if (G_PERFT_HASH_MB > 0) tt.emplace(static_cast<std::size_t>(G_PERFT_HASH_MB) * 1024ULL * 1024ULL);
+
+  std::vector<std::pair<Move, std::uint64_t>> parts;
+  perft_divide(b, depth, parts, PerftOptions{tt ? &*tt : nullptr, G_THREADS, 0});
+  std::uint64_t total = 0;
+  for (const auto& [m, n] : parts) {
+    out << move_to_uci(m) << ": " << n << "\n";
+    total += n;
+  }
+  out << "\nNodes searched: " << total << "\n\n";
+  out.flush();
 }
 
 // ------------ minimal UCI loop ------------
@@ -185,6 +215,9 @@ void uci_loop(std::istream& in, std::ostream& out) {
       out << "id name Euclid\n";
       out << "id author You\n";
       out << "option name EvalModel type string default\n";
+      out << "option name PerftHash type spin default 16 min 0 max 4096\n";
+      out << "option name Hash type spin default 16 min 1 max 65536\n";
+      out << "option name Threads type spin default 1 min 1 max 256\n";
       out << "uciok\n";
       out.flush();
     }
@@ -224,9 +257,20 @@ void uci_loop(std::istream& in, std::ostream& out) {
     else if (cmd == "stop") {
       G_STOP.store(true, std::memory_order_relaxed);
     }
+    else if (cmd == "go" && tokens.size() >= 2 && tokens[1] == "perft") {
+      int depth = 0;
+      try { if (tokens.size() >= 3) depth = std::stoi(tokens[2]); } catch (const std::exception&) {}
+      if (depth < 1) {
+        out << "info string go perft needs a depth >= 1\n";
+        out.flush();
+      } else {
+        run_perft(b, depth, out);
+      }
+    }
     else if (cmd == "go") {
       SearchLimits lim{};
       lim.stop = &G_STOP;
+      lim.threads = G_THREADS;
 
       auto rd_i32 = [&](int& dst) {
         // UCI sends these as integers.
@@ -259,6 +303,12 @@ void uci_loop(std::istream& in, std::ostream& out) {
       G_STOP.store(false, std::memory_order_relaxed);
       SearchResult res = search(b, lim);
 
+      if (res.depth > 0) {
+        out << "info depth " << res.depth << " score cp " << res.score
+            << " nodes " << res.nodes << " hashfull " << res.hashfull << " pv";
+        for (const auto& m : res.pv) out << ' ' << move_to_uci(m);
+        out << "\n";
+      }
       out << "bestmove " << move_to_uci(res.best) << "\n";
       out.flush();
     }
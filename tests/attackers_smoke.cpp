@@ -0,0 +1,40 @@
+#include <cassert>
+#include "euclid/attack.hpp"
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+
+using namespace euclid;
+
+static U64 bb(Square s) { return 1ULL << s; }
+
+int main() {
+  // Every attacker type on e4 (sq 28): pawns d5 (black) and f3 (white), Nc3,
+  // Bb1 (through empty c2/d3), Re8 (down the e-file), Qh4, Kf5.
+  {
+    Board b; set_from_fen(b, "k3r3/8/8/3p1K2/7q/2N2P2/8/1B6 w - - 0 1");
+    const U64 a = attackers_to(b, 28);
+    const U64 want = bb(35) /*d5*/ | bb(21) /*f3*/ | bb(18) /*c3*/ | bb(1) /*b1*/
+                   | bb(60) /*e8*/ | bb(31) /*h4*/ | bb(37) /*f5*/;
+    assert(a == want);
+    assert((a & b.occupancy(Color::White)) == (bb(21) | bb(18) | bb(1) | bb(37)));
+
+    // Sliders follow the occupancy argument: a blocker on e6 hides the rook
+    assert(!(attackers_to(b, 28, b.occupancy() | bb(44)) & bb(60)));
+  }
+
+  // square_attacked agrees with attackers_to on every square for both colors
+  const char* fens[] = {
+    STARTPOS_FEN,
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+  };
+  for (const char* fen : fens) {
+    Board b; set_from_fen(b, fen);
+    for (Square s = 0; s < 64; ++s) {
+      const U64 a = attackers_to(b, s);
+      assert(square_attacked(b, s, Color::White) == ((a & b.occupancy(Color::White)) != 0ULL));
+      assert(square_attacked(b, s, Color::Black) == ((a & b.occupancy(Color::Black)) != 0ULL));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,29 @@
+#include <cassert>
+#include <iostream>
+#include "euclid/attack.hpp"
+#include "euclid/bench.hpp"
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+
+using namespace euclid;
+
+int main() {
+  // Every built-in position loads and is legal (side not to move is not in check)
+  const auto& fens = bench_positions();
+  assert(fens.size() >= 30);
+  for (const auto& fen : fens) {
+    Board b; set_from_fen(b, fen);
+    const Color them = (b.side_to_move() == Color::White) ? Color::Black : Color::White;
+    assert(!in_check(b, them));
+  }
+
+  // The signature is deterministic: search_reset() before each position means
+  // a second run (with warm global state) reproduces the node count exactly.
+  const SearchBenchResult a = run_search_bench(3);
+  const SearchBenchResult b = run_search_bench(3);
+  assert(a.positions == static_cast<int>(fens.size()));
+  assert(a.nodes > 0 && a.nodes == b.nodes);
+
+  std::cout << "bench_signature_smoke ok signature " << a.nodes << "\n";
+  return 0;
+}
@@ -11,7 +11,7 @@ static int count_legal_castles(Board& b) {
   MoveList ml; generate_pseudo_legal(b, ml);
   int n = 0; const Color us = b.side_to_move();
   for (const auto& m : ml) {
-    if (m.flags != MoveFlag::Castle) continue;
+    if (m.flags() != MoveFlag::Castle) continue;
     State st{}; do_move(b, m, st);
     if (!in_check(b, us)) ++n;
     undo_move(b, m, st);
@@ -0,0 +1,58 @@
+#include <cassert>
+#include "euclid/attack.hpp"
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/move_do.hpp"
+#include "euclid/movegen.hpp"
+
+using namespace euclid;
+
+static U64 bb(Square s) { return 1ULL << s; }
+
+int main() {
+  // Occupancy + king squares
+  {
+    Board b; set_from_fen(b, STARTPOS_FEN);
+    assert(b.occupancy(Color::White) == 0x000000000000FFFFULL);
+    assert(b.occupancy(Color::Black) == 0xFFFF000000000000ULL);
+    assert(b.king_square(Color::White) == 4);
+    assert(b.king_square(Color::Black) == 60);
+    assert(b.checkers() == 0ULL && b.pinned() == 0ULL);
+  }
+
+  // Double check (Re2 + Nd3), then a bishop pinned on the a5-e1 diagonal
+  {
+    Board b; set_from_fen(b, "4k3/8/8/8/8/3n4/2B1r3/4K3 w - - 0 1");
+    assert(b.checkers() == (bb(12) | bb(19)));
+    assert(in_check(b, Color::White));
+    assert(!in_check(b, Color::Black));
+    assert(b.pinned() == 0ULL);
+
+    Board p; set_from_fen(p, "4k3/8/8/q7/8/2B5/8/4K3 w - - 0 1");
+    assert(p.checkers() == 0ULL);
+    assert(p.pinned() == bb(18)); // c3 pinned by Qa5
+  }
+
+  // Two blockers => no pin; enemy blocker => no pin
+  {
+    Board b; set_from_fen(b, "4r1k1/8/8/8/8/4P3/4N3/4K3 w - - 0 1");
+    assert(b.pinned() == 0ULL);
+    Board c; set_from_fen(c, "4r1k1/8/8/8/8/4p3/8/4K3 w - - 0 1");
+    assert(c.pinned() == 0ULL);
+  }
+
+  // Cache follows do/undo
+  {
+    Board b; set_from_fen(b, "4k3/8/8/8/8/8/8/R3K3 w - - 0 1");
+    MoveList ml; generate_pseudo_legal(b, ml);
+    for (const auto& m : ml) {
+      if (m.from() != 0 || m.to() != 56) continue; // Ra8+
+      State st{};
+      do_move(b, m, st);
+      assert(b.checkers() == bb(56));
+      undo_move(b, m, st);
+      assert(b.checkers() == 0ULL);
+    }
+  }
+  return 0;
+}
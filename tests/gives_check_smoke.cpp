@@ -0,0 +1,69 @@
+#include <cassert>
+#include <iostream>
+#include "euclid/attack.hpp"
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/move_do.hpp"
+#include "euclid/movegen.hpp"
+
+using namespace euclid;
+
+static int g_checks = 0;
+
+// gives_check must agree with make + in_check for every legal move.
+static void walk(Board& b, int depth) {
+  MoveList ml; generate_legal(b, ml);
+  const CheckSquares cs = check_squares(b);
+  const Color them = (b.side_to_move() == Color::White) ? Color::Black : Color::White;
+  for (const auto& m : ml) {
+    const bool predicted = gives_check(b, m, cs);
+    State st{};
+    do_move(b, m, st);
+    assert(predicted == in_check(b, them));
+    g_checks += predicted ? 1 : 0;
+    if (depth > 1) walk(b, depth - 1);
+    undo_move(b, m, st);
+  }
+}
+
+int main() {
+  const char* fens[] = {
+    STARTPOS_FEN,
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+  };
+  for (const char* fen : fens) {
+    Board b; set_from_fen(b, fen);
+    walk(b, 3);
+  }
+
+  // Special cases: castling rook check, en-passant discovered check, promotion
+  // through the vacated square, plain discovered check.
+  {
+    Board b; set_from_fen(b, "5k2/8/8/8/8/8/8/4K2R w K - 0 1");
+    assert(gives_check(b, Move(4, 6, MoveFlag::Castle)));
+  }
+  {
+    // exd6 e.p. removes both pawns between Ra5 and the king on h5
+    Board b; set_from_fen(b, "8/8/8/R2pP2k/8/8/8/4K3 w - d6 0 1");
+    assert(gives_check(b, Move(36, 43, MoveFlag::EnPassant)));
+  }
+  {
+    // b7xa8=Q checks the king on c6 through the vacated b7 square
+    Board b; set_from_fen(b, "r7/1P6/2k5/8/8/8/8/4K3 w - - 0 1");
+    assert(gives_check(b, make_promotion(49, 56, Piece::Queen, true)));
+    assert(!gives_check(b, make_promotion(49, 56, Piece::Rook, true)));
+  }
+  {
+    // Nd4 off the d-file uncovers Rd1 onto the king on d8
+    Board b; set_from_fen(b, "3k4/8/8/8/3N4/8/8/3RK3 w - - 0 1");
+    assert(gives_check(b, Move(27, 42)));
+    assert(gives_check(b, Move(27, 37)));
+  }
+
+  assert(g_checks > 0);
+  std::cout << "gives_check_smoke ok\n";
+  return 0;
+}
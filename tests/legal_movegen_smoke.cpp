@@ -0,0 +1,106 @@
+#include <cassert>
+#include <cstdint>
+#include "euclid/attack.hpp"
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/move_do.hpp"
+#include "euclid/movegen.hpp"
+
+using namespace euclid;
+
+// Reference: pseudo-legal moves filtered by make/unmake + in_check.
+static int count_filtered(Board& b) {
+  MoveList ml; generate_pseudo_legal(b, ml);
+  const Color us = b.side_to_move();
+  int n = 0;
+  for (const auto& m : ml) {
+    State st{};
+    do_move(b, m, st);
+    const bool ok = !in_check(b, us);
+    undo_move(b, m, st);
+    assert(ok == is_legal(b, m));
+    if (ok) ++n;
+  }
+  return n;
+}
+
+// generate_captures + generate_quiets must partition generate_legal.
+static void check_split(const Board& b, const MoveList& all) {
+  MoveList caps; generate_captures(b, caps);
+  MoveList quiets; generate_quiets(b, quiets);
+  assert(caps.size() + quiets.size() == all.size());
+  for (const auto& m : caps) {
+    assert(m.is_capture() || m.is_promotion());
+    bool found = false;
+    for (const auto& x : all) found = found || (x == m);
+    assert(found);
+  }
+  for (const auto& m : quiets) {
+    assert(!m.is_capture() && !m.is_promotion());
+    bool found = false;
+    for (const auto& x : all) found = found || (x == m);
+    assert(found);
+  }
+}
+
+// In check, generate_evasions must produce exactly the legal moves.
+static void check_evasions(const Board& b, const MoveList& all) {
+  if (!b.checkers()) return;
+  MoveList ev; generate_evasions(b, ev);
+  assert(ev.size() == all.size());
+  for (const auto& m : ev) {
+    bool found = false;
+    for (const auto& x : all) found = found || (x == m);
+    assert(found);
+  }
+}
+
+static void walk(Board& b, int depth) {
+  MoveList ml; generate_legal(b, ml);
+  assert(static_cast<int>(ml.size()) == count_filtered(b));
+  check_split(b, ml);
+  check_evasions(b, ml);
+  if (depth == 0) return;
+  for (const auto& m : ml) {
+    State st{};
+    do_move(b, m, st);
+    walk(b, depth - 1);
+    undo_move(b, m, st);
+  }
+}
+
+int main() {
+  const char* fens[] = {
+    STARTPOS_FEN,
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+  };
+  for (const char* fen : fens) {
+    Board b; set_from_fen(b, fen);
+    walk(b, 2);
+  }
+
+  // En passant that would expose the king along the rank is rejected
+  {
+    Board b; set_from_fen(b, "8/8/8/KPp4r/8/8/8/4k3 w - c6 0 1");
+    MoveList ml; generate_legal(b, ml);
+    for (const auto& m : ml) assert(m.flags() != MoveFlag::EnPassant);
+  }
+
+  // Double check: only king moves
+  {
+    Board b; set_from_fen(b, "4k3/8/8/8/8/3n4/2B1r3/4K3 w - - 0 1");
+    MoveList ml; generate_legal(b, ml);
+    assert(!ml.empty());
+    for (const auto& m : ml) assert(m.from() == b.king_square(Color::White));
+  }
+
+  // Checkmate: no legal moves
+  {
+    Board b; set_from_fen(b, "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3");
+    MoveList ml; generate_legal(b, ml);
+    assert(ml.empty());
+  }
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <cassert>
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/movegen.hpp"
+#include "euclid/move_do.hpp"
+
+using namespace euclid;
+
+// piece_at (mailbox) must agree with the bitboards on every square.
+static void check_sync(const Board& b) {
+  for (Square s = 0; s < 64; ++s) {
+    Color c;
+    const Piece p = b.piece_at(s, &c);
+    int hits = 0;
+    for (int ci = 0; ci < COLOR_N; ++ci) {
+      for (int pi = 0; pi < PIECE_N; ++pi) {
+        if (b.pieces(static_cast<Color>(ci), static_cast<Piece>(pi)) & (1ULL << s)) {
+          ++hits;
+          assert(p == static_cast<Piece>(pi));
+          assert(c == static_cast<Color>(ci));
+        }
+      }
+    }
+    assert(hits == (p == Piece::None ? 0 : 1));
+  }
+}
+
+static void walk(Board& b, int depth) {
+  check_sync(b);
+  if (depth == 0) return;
+  MoveList ml; generate_pseudo_legal(b, ml);
+  for (const auto& m : ml) {
+    State st{};
+    do_move(b, m, st);
+    walk(b, depth - 1);
+    undo_move(b, m, st);
+  }
+  check_sync(b);
+}
+
+int main() {
+  Board b;
+  set_from_fen(b, "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+  walk(b, 2);
+
+  b.clear();
+  Color c;
+  for (Square s = 0; s < 64; ++s) assert(b.piece_at(s, &c) == Piece::None && c == Color::White);
+  return 0;
+}
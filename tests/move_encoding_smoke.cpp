@@ -0,0 +1,61 @@
+#include <cassert>
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/move.hpp"
+#include "euclid/movegen.hpp"
+#include "euclid/tt.hpp"
+
+using namespace euclid;
+
+static_assert(sizeof(Move) == 2, "Move must stay packed into 16 bits");
+static_assert(sizeof(MoveList) <= MoveList::CAP * 3 + sizeof(std::size_t), "MoveList: 2-byte move + 1-byte victim per slot");
+
+int main() {
+  // Round trip of every from/to pair with a plain flag
+  for (Square f = 0; f < 64; ++f) {
+    for (Square t = 0; t < 64; ++t) {
+      const Move m(f, t, MoveFlag::Capture);
+      assert(m.from() == f && m.to() == t);
+      assert(m.flags() == MoveFlag::Capture);
+      assert(m.is_capture() && !m.is_promotion());
+      assert(m.promo() == Piece::None);
+    }
+  }
+
+  // Promotions encode the piece and the capture bit
+  {
+    const Move q = make_promotion(52, 60, Piece::Queen, false);
+    assert(q.is_promotion() && !q.is_capture());
+    assert(q.promo() == Piece::Queen && q.flags() == MoveFlag::PromoQueen);
+    const Move n = make_promotion(52, 61, Piece::Knight, true);
+    assert(n.is_promotion() && n.is_capture());
+    assert(n.promo() == Piece::Knight && n.flags() == MoveFlag::PromoKnightCapture);
+    assert(Move(36, 43, MoveFlag::EnPassant).is_capture());
+    assert(Move{}.is_null() && !Move(12, 28, MoveFlag::DoublePush).is_null());
+  }
+
+  // The generator records the captured piece type (Pawn for en passant)
+  {
+    Board b; set_from_fen(b, "4k3/8/8/3pP3/8/2n5/1P6/4K3 w - d6 0 1");
+    MoveList ml; generate_legal(b, ml);
+    bool sawEp = false, sawKnight = false;
+    for (std::size_t i = 0; i < ml.size(); ++i) {
+      const Move m = ml.data[i];
+      if (m.flags() == MoveFlag::EnPassant) { sawEp = true; assert(ml.captured(i) == Piece::Pawn); }
+      else if (m.to() == 18) { sawKnight = true; assert(m.is_capture() && ml.captured(i) == Piece::Knight); }
+      else if (!m.is_capture()) assert(ml.captured(i) == Piece::None);
+    }
+    assert(sawEp && sawKnight);
+  }
+
+  // TT stores the packed move unchanged
+  {
+    TT tt(1 << 16);
+    const Move m = make_promotion(48, 57, Piece::Rook, true);
+    tt.store(0x1234ULL, m, 3, 17, TTBound::Exact);
+    TTEntry e{};
+    assert(tt.probe(0x1234ULL, e));
+    assert(e.best == m);
+  }
+  return 0;
+}
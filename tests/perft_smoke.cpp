@@ -6,13 +6,53 @@
 int main() {
   using namespace euclid;
 
-  // Startpos: with knight-only movegen, depth 1 -> 4 moves (two knights, two options each)
   Board b;
   set_from_fen(b, STARTPOS_FEN);
 
   assert(perft(b, 0) == 1ULL);
-  assert(perft(b, 1) == 4ULL);
-  assert(perft(b, 2) == 16ULL);
+  assert(perft(b, 1) == 20ULL);
+  assert(perft(b, 2) == 400ULL);
+  assert(perft(b, 3) == 8902ULL);
+
+  // The perft cache must not change counts, cold or warm (tiny table forces
+  // index collisions, which the key/depth check has to reject).
+  Board kiwi;
+  set_from_fen(kiwi, "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+  for (std::size_t bytes : {std::size_t{1} << 10, std::size_t{1} << 20}) {
+    PerftTT tt(bytes);
+    assert(perft(kiwi, 3, &tt) == 97862ULL);
+    assert(perft(kiwi, 3, &tt) == 97862ULL);
+  }
+
+  std::vector<std::pair<Move, std::uint64_t>> parts;
+  perft_divide(b, 3, parts);
+  std::uint64_t total = 0;
+  for (const auto& [m, n] : parts) total += n;
+  assert(parts.size() == 20 && total == 8902ULL);
+
+  // Parallel perft: any thread count / split depth, with and without a shared hash
+  PerftTT shared(std::size_t{1} << 16);
+  for (int threads : {2, 3}) {
+    for (int split : {0, 1, 2}) {
+      assert(perft(kiwi, 3, PerftOptions{nullptr, threads, split}) == 97862ULL);
+      assert(perft(kiwi, 3, PerftOptions{&shared, threads, split}) == 97862ULL);
+    }
+  }
+  std::vector<std::pair<Move, std::uint64_t>> pparts;
+  perft_divide(b, 3, pparts, PerftOptions{nullptr, 4, 2});
+  assert(pparts == parts);
+
+  // EPD suite lines: 4-field FENs get default clocks, ";Dn count" entries in order
+  PerftEpd epd;
+  const bool parsed = parse_perft_epd("4k3/8/8/8/8/8/8/4K2R w K - ;D1 15 ;D2 66", epd);
+  assert(parsed);
+  (void)parsed;
+  assert(epd.fen == "4k3/8/8/8/8/8/8/4K2R w K - 0 1");
+  assert(epd.refs.size() == 2 && epd.refs[1].first == 2 && epd.refs[1].second == 66ULL);
+  Board e; set_from_fen(e, epd.fen);
+  for (const auto& [d, n] : epd.refs) assert(perft(e, d) == n);
+  assert(!parse_perft_epd("# comment ;D1 1", epd));
+  assert(!parse_perft_epd("", epd));
 
   return 0;
 }
@@ -0,0 +1,58 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/move_do.hpp"
+#include "euclid/movegen.hpp"
+
+using namespace euclid;
+
+static int g_positions = 0;
+
+// Every 16-bit encoding: is_pseudo_legal && is_legal must hold exactly for the
+// moves generate_legal produces, and every pseudo-legal move must be accepted.
+static void check_all_encodings(const Board& b) {
+  MoveList legal; generate_legal(b, legal);
+  MoveList pseudo; generate_pseudo_legal(b, pseudo);
+  bool isLegal[1 << 16] = {};
+  for (const auto& m : legal) isLegal[m.data] = true;
+  for (const auto& m : pseudo) assert(is_pseudo_legal(b, m));
+
+  for (std::uint32_t v = 0; v < (1u << 16); ++v) {
+    Move m; m.data = static_cast<std::uint16_t>(v);
+    const bool ok = is_pseudo_legal(b, m) && is_legal(b, m);
+    assert(ok == isLegal[v]);
+  }
+  ++g_positions;
+}
+
+static void walk(Board& b, int depth) {
+  check_all_encodings(b);
+  if (depth == 0) return;
+  MoveList ml; generate_legal(b, ml);
+  for (const auto& m : ml) {
+    State st{};
+    do_move(b, m, st);
+    walk(b, depth - 1);
+    undo_move(b, m, st);
+  }
+}
+
+int main() {
+  const char* fens[] = {
+    STARTPOS_FEN,
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 0 1",
+  };
+  for (const char* fen : fens) {
+    Board b; set_from_fen(b, fen);
+    walk(b, 2);
+  }
+
+  std::cout << "pseudo_legal_smoke ok positions " << g_positions << "\n";
+  return 0;
+}
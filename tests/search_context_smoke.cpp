@@ -0,0 +1,76 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/search.hpp"
+
+using namespace euclid;
+
+int main() {
+  const char* fens[] = {
+    STARTPOS_FEN,
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+  };
+  constexpr int N = 4;
+  constexpr int DEPTH = 5;
+
+  // Reference: each position searched alone in a fresh context.
+  std::vector<SearchResult> ref(N);
+  for (int i = 0; i < N; ++i) {
+    Board b;
+    set_from_fen(b, fens[i]);
+    SearchContext ctx;
+    ref[i] = ctx.search(b, DEPTH);
+    assert(ref[i].depth == DEPTH && !ref[i].best.is_null());
+  }
+
+  // Same searches, all at once, one context per thread: a context shares no
+  // state with the others, so every result (node count included) must match.
+  std::vector<SearchResult> got(N);
+  {
+    std::vector<std::thread> pool;
+    for (int i = 0; i < N; ++i) {
+      pool.emplace_back([&, i] {
+        Board b;
+        set_from_fen(b, fens[i]);
+        SearchContext ctx;
+        got[i] = ctx.search(b, DEPTH);
+      });
+    }
+    for (auto& t : pool) t.join();
+  }
+  for (int i = 0; i < N; ++i) {
+    assert(got[i].best == ref[i].best);
+    assert(got[i].score == ref[i].score);
+    assert(got[i].nodes == ref[i].nodes);
+  }
+
+  // reset() puts a used context back to the fresh-context search.
+  {
+    Board b;
+    set_from_fen(b, fens[1]);
+    SearchContext ctx;
+    (void)ctx.search(b, DEPTH + 1);
+    ctx.reset();
+    const SearchResult r = ctx.search(b, DEPTH);
+    assert(r.nodes == ref[1].nodes && r.best == ref[1].best);
+  }
+
+  // The free functions keep working on the default context, untouched by the above.
+  {
+    Board b;
+    set_from_fen(b, fens[0]);
+    search_reset();
+    const SearchResult r = search(b, DEPTH);
+    assert(r.nodes == ref[0].nodes && r.best == ref[0].best);
+  }
+
+  std::cout << "search_context_smoke ok\n";
+  return 0;
+}
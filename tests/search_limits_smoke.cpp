@@ -24,6 +24,17 @@ int main() {
   assert(stop.load(std::memory_order_relaxed) == true);
   assert(r.nodes <= lim.nodes);
 
+  // Stopped inside depth 1: no depth finished, but the nodes spent are reported.
+  stop.store(false, std::memory_order_relaxed);
+  SearchLimits lim1{};
+  lim1.depth = 8;
+  lim1.nodes = 10;
+  lim1.stop  = &stop;
+
+  SearchResult r1 = search(b, lim1);
+  assert(r1.depth == 0);
+  assert(r1.nodes == lim1.nodes);
+
   // Pre-stopped: should return immediately with 0 nodes and depth 0.
   stop.store(true, std::memory_order_relaxed);
   SearchLimits lim2{};
@@ -23,7 +23,7 @@ static bool move_is_legal(const Board& b, const Move& m) {
   generate_pseudo_legal(b, ml);
   const Color us = b.side_to_move();
   for (const auto& cand : ml) {
-    if (cand.from == m.from && cand.to == m.to && cand.promo == m.promo) {
+    if (cand.from() == m.from() && cand.to() == m.to() && cand.promo() == m.promo()) {
       State st{};
       Board tmp = b;
       do_move(tmp, cand, st);
@@ -51,13 +51,24 @@ int main() {
   Board b; set_from_fen(b, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
 
   SearchResult r = search(b, 4);
-  assert((r.best.from | r.best.to | (int)r.best.promo) != 0);
+  assert((r.best.from() | r.best.to() | (int)r.best.promo()) != 0);
   assert(move_is_legal(b, r.best));
 
   // Also run through UCI conversion to ensure it prints sanely
   std::cout << "best " << move_to_uci(r.best) << " score " << r.score << " depth " << r.depth
             << " nodes " << r.nodes << "\n";
 
+  // Mate in one found at the horizon: qsearch must score "in check, no evasions"
+  // as mate (it used to return alpha, which sent the aspiration loop spinning).
+  {
+    Board m; set_from_fen(m, "r1bqkb1r/pppp1ppp/2n2n2/4p2Q/2B1P3/8/PPPP1PPP/RNB1K1NR w KQkq - 4 4");
+    for (int d = 1; d <= 3; ++d) {
+      SearchResult mr = search(m, d);
+      assert(move_to_uci(mr.best) == "h5f7");
+      assert(mr.score > 20000);
+    }
+  }
+
   std::cout << "search_smoke ok\n";
   return 0;
 }
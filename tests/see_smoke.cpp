@@ -0,0 +1,58 @@
+#include <cassert>
+#include <iostream>
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/movegen.hpp"
+#include "euclid/see.hpp"
+
+using namespace euclid;
+
+static Move find_move(const Board& b, Square from, Square to) {
+  MoveList ml; generate_legal(b, ml);
+  for (const auto& m : ml) {
+    if (m.from() == from && m.to() == to) return m;
+  }
+  assert(false && "move not found");
+  return Move{};
+}
+
+static int see_of(const char* fen, Square from, Square to) {
+  Board b; set_from_fen(b, fen);
+  return see(b, find_move(b, from, to));
+}
+
+int main() {
+  // Undefended pawn: Re1xe5
+  assert(see_of("1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1", 4, 36) == 100);
+  // Knight takes a pawn defended by a knight and x-rayed by bishop/queen: Nd3xe5
+  assert(see_of("1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1", 19, 36) == -220);
+  // Queen takes a pawn defended by a pawn: Qd1xd5
+  assert(see_of("4k3/8/2p5/3p4/8/8/8/3QK3 w - - 0 1", 3, 35) == -800);
+  // X-ray: the second rook behind Rd2 wins the exchange back
+  assert(see_of("3rk3/8/8/3p4/8/8/3R4/3RK3 w - - 0 1", 11, 35) == 100);
+  // The king may recapture only an undefended piece
+  assert(see_of("8/8/4k3/3p4/8/8/8/3RK3 w - - 0 1", 3, 35) == -400);
+  assert(see_of("8/8/4k3/3p4/8/8/3R4/3RK3 w - - 0 1", 11, 35) == 100);
+  // En passant captures a pawn that is not on the destination square
+  assert(see_of("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1", 36, 43) == 100);
+
+  // see_ge(t) agrees with see() >= t for every capture in a few busy positions
+  const char* fens[] = {
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1",
+  };
+  for (const char* fen : fens) {
+    Board b; set_from_fen(b, fen);
+    MoveList ml; generate_captures(b, ml);
+    for (const auto& m : ml) {
+      const int v = see(b, m);
+      for (int t : {-1000, -500, -100, -1, 0, 1, 100, 300, 500, 1000}) {
+        assert(see_ge(b, m, t) == (v >= t));
+      }
+    }
+  }
+
+  std::cout << "see_smoke ok\n";
+  return 0;
+}
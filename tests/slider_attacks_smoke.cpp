@@ -0,0 +1,57 @@
+#include <cassert>
+#include <cstdint>
+#include "euclid/attacks_tbl.hpp"
+#include "euclid/types.hpp"
+
+using namespace euclid;
+
+// Runs during static initialization, in no particular order relative to
+// attacks_tbl.cpp: the SliderInit object from the header must already have run.
+static const U64 EARLY_ROOK_A1 = rook_attacks(0, 0ULL);
+static const U64 EARLY_BISHOP_D4 = bishop_attacks(27, 0ULL);
+
+// Reference: walk ATT().rays until (and including) the first blocker.
+static U64 walk(int s, U64 occ, const int* dirs, int nd) {
+  const auto& T = ATT();
+  U64 out = 0;
+  for (int k = 0; k < nd; ++k) {
+    const int d = dirs[k];
+    for (int i = 0; i < T.ray_len[d][s]; ++i) {
+      const int t = T.rays[d][s][i];
+      out |= 1ULL << t;
+      if (occ & (1ULL << t)) break;
+    }
+  }
+  return out;
+}
+
+int main() {
+  assert(EARLY_ROOK_A1 == 0x01010101010101FEULL);
+  assert(__builtin_popcountll(EARLY_BISHOP_D4) == 13);
+
+  static const int ROOK_DIRS[4]   = {DIR_N, DIR_E, DIR_S, DIR_W};
+  static const int BISHOP_DIRS[4] = {DIR_NE, DIR_SE, DIR_SW, DIR_NW};
+
+  static const SliderBackend BACKENDS[3] = {SliderBackend::Magic, SliderBackend::Pext, SliderBackend::Ray};
+  for (SliderBackend be : BACKENDS) {
+    if (!set_slider_backend(be)) continue; // e.g. no BMI2 on this CPU
+    assert(slider_backend() == be);
+
+    std::uint64_t x = 0x1234567890abcdefULL;
+    for (int iter = 0; iter < 2000; ++iter) {
+      x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+      const U64 occ = x & (x >> 3); // ~25% density
+      for (int s = 0; s < 64; ++s) {
+        assert(rook_attacks(s, occ)   == walk(s, occ, ROOK_DIRS, 4));
+        assert(bishop_attacks(s, occ) == walk(s, occ, BISHOP_DIRS, 4));
+        assert(queen_attacks(s, occ)  == (rook_attacks(s, occ) | bishop_attacks(s, occ)));
+      }
+    }
+  }
+  assert(set_slider_backend(detect_slider_backend()));
+
+  // Empty board: a rook always sees 14 squares.
+  for (int s = 0; s < 64; ++s) assert(__builtin_popcountll(rook_attacks(s, 0ULL)) == 14);
+
+  return 0;
+}
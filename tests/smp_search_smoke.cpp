@@ -0,0 +1,99 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/movegen.hpp"
+#include "euclid/search.hpp"
+#include "euclid/uci.hpp"
+
+using namespace euclid;
+
+static bool is_generated_legal(const Board& b, const Move& m) {
+  MoveList ml;
+  generate_legal(b, ml);
+  for (const auto& x : ml) {
+    if (x == m) return true;
+  }
+  return false;
+}
+
+int main() {
+  const char* fens[] = {
+    STARTPOS_FEN,
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+  };
+
+  // Fixed depth with helpers: every thread finishes or is stopped, and the
+  // main thread's full-depth result (legal move + PV) is reported.
+  for (const char* fen : fens) {
+    Board b;
+    set_from_fen(b, fen);
+    search_reset();
+
+    SearchLimits lim{};
+    lim.depth = 5;
+    lim.threads = 4;
+    SearchResult r = search(b, lim);
+
+    assert(r.depth == 5);
+    assert(!r.pv.empty() && r.pv.front() == r.best);
+    assert(is_generated_legal(b, r.best));
+    assert(r.nodes > 0);
+  }
+
+  // Mate in one is still found with helpers writing the same TT.
+  {
+    Board m;
+    set_from_fen(m, "r1bqkb1r/pppp1ppp/2n2n2/4p2Q/2B1P3/8/PPPP1PPP/RNB1K1NR w KQkq - 4 4");
+    SearchLimits lim{};
+    lim.depth = 4;
+    lim.threads = 3;
+    SearchResult r = search(m, lim);
+    assert(move_to_uci(r.best) == "h5f7");
+    assert(r.score > 20000);
+  }
+
+  // A node limit is exact even when threads are requested (helpers are not started).
+  {
+    Board b;
+    set_from_fen(b, fens[1]);
+    std::atomic<bool> stop{false};
+    SearchLimits lim{};
+    lim.depth = 32;
+    lim.nodes = 5000;
+    lim.threads = 4;
+    lim.stop = &stop;
+    SearchResult r = search(b, lim);
+    assert(stop.load(std::memory_order_relaxed));
+    assert(r.nodes <= lim.nodes);
+  }
+
+  // movetime: the main thread stops on its deadline and the helpers follow.
+  {
+    Board b;
+    set_from_fen(b, STARTPOS_FEN);
+    std::atomic<bool> stop{false};
+    SearchLimits lim{};
+    lim.depth = 64;
+    lim.movetime_ms = 200;
+    lim.threads = 4;
+    lim.stop = &stop;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    SearchResult r = search(b, lim);
+    const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    assert(r.depth >= 1);
+    assert(is_generated_legal(b, r.best));
+    assert(sec < 5.0);
+  }
+
+  std::cout << "smp_search_smoke ok\n";
+  return 0;
+}
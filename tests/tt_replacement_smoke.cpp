@@ -0,0 +1,106 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "euclid/tt.hpp"
+
+using namespace euclid;
+
+// TT(64) is a single bucket, so every key below collides; the TT tells keys
+// apart by their top 16 bits.
+static U64 key_n(int n) { return static_cast<U64>(n + 1) << 48; }
+
+static bool has(const TT& tt, U64 key) {
+  TTEntry e{};
+  return tt.probe(key, e);
+}
+
+int main() {
+  // A bucket holds BUCKET_ENTRIES keys side by side.
+  {
+    TT tt(64);
+    for (int i = 0; i < (int)TT::BUCKET_ENTRIES; ++i) {
+      tt.store(key_n(i), Move(8, 16), static_cast<std::int16_t>(4 + i), 10, TTBound::Exact);
+    }
+    for (int i = 0; i < (int)TT::BUCKET_ENTRIES; ++i) assert(has(tt, key_n(i)));
+
+    // A full bucket evicts its shallowest entry.
+    tt.store(key_n(9), Move(8, 16), 7, 10, TTBound::Exact);
+    assert(has(tt, key_n(9)));
+    assert(!has(tt, key_n(0)));
+    for (int i = 1; i < (int)TT::BUCKET_ENTRIES; ++i) assert(has(tt, key_n(i)));
+  }
+
+  // Aging: a deep entry from an old search goes before shallow current ones.
+  {
+    TT tt(64);
+    tt.store(key_n(0), Move(8, 16), 20, 10, TTBound::Exact);
+    tt.new_search();
+    tt.new_search();
+    tt.new_search();
+    for (int i = 1; i < (int)TT::BUCKET_ENTRIES; ++i) {
+      tt.store(key_n(i), Move(8, 16), 5, 10, TTBound::Lower);
+    }
+    tt.store(key_n(9), Move(8, 16), 1, 10, TTBound::Upper);
+    assert(has(tt, key_n(9)));
+    assert(!has(tt, key_n(0)));
+  }
+
+  // Same key: a much deeper entry of this search survives a shallow bound,
+  // but not an exact score or the next search.
+  {
+    TT tt(64);
+    const U64 k = key_n(0);
+    TTEntry e{};
+    tt.store(k, Move(12, 28), 10, 50, TTBound::Lower);
+    tt.store(k, Move(6, 21), 3, -5, TTBound::Upper);
+    assert(tt.probe(k, e) && e.depth == 10 && e.best == Move(12, 28));
+
+    tt.store(k, Move(6, 21), 3, -5, TTBound::Exact);
+    assert(tt.probe(k, e) && e.depth == 3 && e.score == -5 && e.bound == TTBound::Exact);
+
+    tt.store(k, Move(12, 28), 10, 50, TTBound::Lower);
+    tt.new_search();
+    tt.store(k, Move(6, 21), 2, 7, TTBound::Upper);
+    assert(tt.probe(k, e) && e.depth == 2 && e.bound == TTBound::Upper);
+
+    // A store without a move keeps the known best move for the position.
+    tt.store(k, Move{}, 4, 30, TTBound::Lower);
+    assert(tt.probe(k, e) && e.depth == 4 && e.best == Move(6, 21));
+  }
+
+  // hashfull counts slots written during the current search only.
+  {
+    TT tt(64);
+    assert(tt.hashfull() == 0);
+    tt.store(key_n(0), Move(8, 16), 3, 0, TTBound::Exact);
+    tt.store(key_n(1), Move(8, 16), 3, 0, TTBound::Exact);
+    assert(tt.hashfull() == static_cast<int>(2000 / TT::BUCKET_ENTRIES));
+    tt.new_search();
+    assert(tt.hashfull() == 0);
+    tt.clear();
+    assert(!has(tt, key_n(0)));
+  }
+
+  // Sizes round down to a power of two buckets: never more than asked for.
+  // Checked outside assert so Release builds still fail on an oversized table.
+  int bad = 0;
+  {
+    constexpr std::size_t MB = 1024 * 1024;
+    const std::size_t asked[] = {17 * MB, 16 * MB, 3 * 64, 100};
+    const std::size_t want[]  = {16 * MB, 16 * MB, 2 * 64, 64};
+    TT tt;
+    for (std::size_t i = 0; i < 4; ++i) {
+      tt.resize(asked[i]);
+      const bool ok = tt.bytes() == want[i];
+      assert(ok);
+      if (!ok) ++bad;
+    }
+    tt.store(key_n(0), Move(8, 16), 3, 0, TTBound::Exact);
+    assert(has(tt, key_n(0)));
+  }
+
+  std::cout << "tt_replacement_smoke ok\n";
+  return bad == 0 ? 0 : 1;
+}
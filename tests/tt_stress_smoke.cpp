@@ -0,0 +1,160 @@
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "euclid/board.hpp"
+#include "euclid/fen.hpp"
+#include "euclid/move_do.hpp"
+#include "euclid/movegen.hpp"
+#include "euclid/tt.hpp"
+
+using namespace euclid;
+
+// Every thread both stores and probes a small table from a shared key pool, so
+// slots are overwritten concurrently all the time. Each store's fields are a
+// function of (key, r) with r = (uint16)score, so a probe that mixed two
+// stores (or read a slot mid-write) would fail the consistency check.
+
+static U64 splitmix(U64& s) {
+  U64 z = (s += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// Never 0: a store without a move keeps the slot's old one, which would break
+// the (key, r) consistency this test relies on.
+static std::uint16_t move_for(U64 key, std::uint16_t r) {
+  const auto m = static_cast<std::uint16_t>(key ^ (key >> 23) ^ (r * 0x9E37u));
+  return m != 0 ? m : std::uint16_t{1};
+}
+
+// Walks every position up to 'depth' plies, stopping at the first one whose key
+// shares its top 16 bits (all the TT keeps) with an earlier, different key.
+static bool find_tag_collision(Board& b, int depth, std::unordered_map<std::uint16_t, Board>& seen,
+                               Board& first, Board& second) {
+  const auto tag = static_cast<std::uint16_t>(b.hash() >> 48);
+  const auto it = seen.find(tag);
+  if (it == seen.end()) {
+    seen.emplace(tag, b);
+  } else if (it->second.hash() != b.hash()) {
+    first = it->second;
+    second = b;
+    return true;
+  }
+  if (depth == 0) return false;
+
+  MoveList ml;
+  generate_legal(b, ml);
+  for (const auto& m : ml) {
+    State st{};
+    do_move(b, m, st);
+    const bool found = find_tag_collision(b, depth - 1, seen, first, second);
+    undo_move(b, m, st);
+    if (found) return true;
+  }
+  return false;
+}
+
+int main() {
+  constexpr int THREADS = 8;
+  constexpr int ITERS = 1000000;
+  constexpr std::size_t POOL = 4096;
+
+  // The TT only keeps the top 16 key bits, so keep those distinct within the
+  // pool: any hit must then belong to the probed key.
+  std::vector<U64> keys;
+  std::vector<bool> tagUsed(1u << 16, false);
+  U64 seed = 12345;
+  while (keys.size() < POOL) {
+    const U64 k = splitmix(seed);
+    if (tagUsed[k >> 48]) continue;
+    tagUsed[k >> 48] = true;
+    keys.push_back(k);
+  }
+
+  TT tt(4096); // 512 slots: constant collisions and replacements
+
+  std::atomic<std::uint64_t> hits{0};
+  std::atomic<std::uint64_t> bad{0};
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < THREADS; ++t) {
+    pool.emplace_back([&, t] {
+      U64 s = 0xC0FFEEULL + static_cast<U64>(t);
+      std::uint64_t myHits = 0, myBad = 0;
+      for (int i = 0; i < ITERS; ++i) {
+        const U64 rnd = splitmix(s);
+        const U64 key = keys[rnd % POOL];
+        const std::uint16_t r = static_cast<std::uint16_t>(rnd >> 32);
+
+        if (rnd & (1ULL << 20)) {
+          Move m;
+          m.data = move_for(key, r);
+          tt.store(key, m, static_cast<std::int16_t>(r % 50),
+                   static_cast<std::int16_t>(r), static_cast<TTBound>(r % 3));
+        } else {
+          TTEntry e{};
+          if (!tt.probe(key, e)) continue;
+          ++myHits;
+          const std::uint16_t er = static_cast<std::uint16_t>(e.score);
+          if (e.depth != er % 50 || e.bound != static_cast<TTBound>(er % 3) ||
+              e.best.data != move_for(key, er)) {
+            ++myBad;
+          }
+        }
+      }
+      hits.fetch_add(myHits);
+      bad.fetch_add(myBad);
+    });
+  }
+  for (auto& th : pool) th.join();
+
+  assert(hits.load() > 0);
+  assert(bad.load() == 0);
+
+  // clear() empties every slot
+  tt.clear();
+  for (U64 k : keys) {
+    TTEntry e{};
+    assert(!tt.probe(k, e));
+  }
+
+  // Tag collisions: two real positions whose keys share the stored 16 bits and
+  // (in a one-bucket table) the bucket. probe() cannot tell them apart, so the
+  // second position gets the first one's entry; the search's move validation
+  // (is_pseudo_legal + is_legal) must reject the foreign move.
+  {
+    Board root;
+    set_from_fen(root, STARTPOS_FEN);
+    std::unordered_map<std::uint16_t, Board> seen;
+    Board a, b;
+    bool ok = find_tag_collision(root, 4, seen, a, b);
+    ok = ok && a.hash() != b.hash() && (a.hash() >> 48) == (b.hash() >> 48);
+
+    Move foreign{};
+    if (ok) {
+      MoveList ml;
+      generate_legal(a, ml);
+      for (const auto& m : ml) {
+        if (!(is_pseudo_legal(b, m) && is_legal(b, m))) { foreign = m; break; }
+      }
+    }
+    ok = ok && !foreign.is_null();
+
+    TT one(64);
+    one.store(a.hash(), foreign, 5, 42, TTBound::Exact);
+    TTEntry e{};
+    ok = ok && one.probe(b.hash(), e) && e.best == foreign;         // the layout's blind spot...
+    ok = ok && !(is_pseudo_legal(b, e.best) && is_legal(b, e.best)); // ...caught by move validation
+    assert(ok);
+    if (!ok) ++bad;
+  }
+
+  std::cout << "tt_stress_smoke ok (hits " << hits.load() << ", bad " << bad.load() << ")\n";
+  return bad.load() == 0 ? 0 : 1;
+}
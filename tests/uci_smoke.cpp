@@ -1,4 +1,6 @@
 #include <cassert>
+#include <sstream>
+#include <string>
 #include <vector>
 #include "euclid/fen.hpp"
 #include "euclid/perft.hpp"
@@ -34,5 +36,19 @@ int main() {
     for (auto& kv : items) sum += kv.second;
     assert(sum == perft(b, 2));
   }
-  return 0;
+  // go perft: bad depths are reported, not thrown; Threads runs the workers
+  int bad = 0;
+  {
+    std::istringstream in("go perft\ngo perft x\ngo perft -1\n"
+                          "setoption name Threads value 2\ngo perft 3\nquit\n");
+    std::ostringstream out;
+    uci_loop(in, out);
+    const std::string s = out.str();
+    std::size_t errors = 0;
+    for (std::size_t p = s.find("info string"); p != std::string::npos; p = s.find("info string", p + 1)) ++errors;
+    const bool ok = errors == 3 && s.find("Nodes searched: 8902\n") != std::string::npos;
+    assert(ok);
+    if (!ok) ++bad;
+  }
+  return bad == 0 ? 0 : 1;
 }